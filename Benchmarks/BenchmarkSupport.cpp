@@ -0,0 +1,394 @@
+/**
+This file provides the support shared by the benchmark programs: an
+allocation counter, a stopwatch, the key workloads, a Zipfian key
+generator, the command line options and the result table.
+
+@author		Solomon Colley
+@file		BenchmarkSupport.cpp
+@since		10/18/2026
+*/
+
+#include "BenchmarkSupport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+
+// -------------------------------------------------------------------------------------
+// Allocation Counting Section.
+// -------------------------------------------------------------------------------------
+
+namespace
+{
+	std::atomic<long long> allocationCount(0);	// Calls made to operator new.
+	volatile long long optimizationSink = 0;	// Receives values passed to doNotOptimize.
+} // end namespace
+
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	void* memoryPtr = std::malloc(size == 0 ? 1 : size);
+	if (memoryPtr == nullptr)
+		throw std::bad_alloc(); // end if-else
+	return memoryPtr;
+} // end operator new
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+} // end operator new[]
+
+void operator delete(void* memoryPtr) noexcept
+{
+	std::free(memoryPtr);
+} // end operator delete
+
+void operator delete[](void* memoryPtr) noexcept
+{
+	std::free(memoryPtr);
+} // end operator delete[]
+
+void operator delete(void* memoryPtr, std::size_t) noexcept
+{
+	std::free(memoryPtr);
+} // end operator delete
+
+void operator delete[](void* memoryPtr, std::size_t) noexcept
+{
+	std::free(memoryPtr);
+} // end operator delete[]
+
+long long getAllocationCount()
+{
+	return allocationCount.load(std::memory_order_relaxed);
+} // end getAllocationCount
+
+void doNotOptimize(long long value)
+{
+	optimizationSink = optimizationSink + value;
+} // end doNotOptimize
+
+// -------------------------------------------------------------------------------------
+// Stopwatch Section.
+// -------------------------------------------------------------------------------------
+
+namespace
+{
+	std::int64_t getNowNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	} // end getNowNanoseconds
+} // end namespace
+
+Stopwatch::Stopwatch() : startNanoseconds(getNowNanoseconds())
+{
+} // end default constructor
+
+void Stopwatch::restart()
+{
+	startNanoseconds = getNowNanoseconds();
+} // end restart
+
+std::int64_t Stopwatch::getElapsedNanoseconds() const
+{
+	return getNowNanoseconds() - startNanoseconds;
+} // end getElapsedNanoseconds
+
+// -------------------------------------------------------------------------------------
+// Zipf Generator Section.
+// See W. Hormann and G. Derflinger, "Rejection-inversion to generate variates
+// from monotone discrete distributions", 1996.
+// -------------------------------------------------------------------------------------
+
+namespace
+{
+	// Returns log(1 + x) / x, continued to 1 at x = 0.
+	double log1pOverX(double x)
+	{
+		return (std::fabs(x) > 1e-8) ? std::log1p(x) / x : 1.0 - x / 2.0;
+	} // end log1pOverX
+
+	// Returns (exp(x) - 1) / x, continued to 1 at x = 0.
+	double expm1OverX(double x)
+	{
+		return (std::fabs(x) > 1e-8) ? std::expm1(x) / x : 1.0 + x / 2.0;
+	} // end expm1OverX
+} // end namespace
+
+ZipfGenerator::ZipfGenerator(int numberOfElements, double exponent)
+	: numberOfElements(numberOfElements), exponent(exponent)
+{
+	hIntegralX1 = hIntegral(1.5) - 1.0;
+	hIntegralNumberOfElements = hIntegral(numberOfElements + 0.5);
+	squeeze = 2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0));
+} // end parameterized constructor
+
+double ZipfGenerator::h(double x) const
+{
+	return std::exp(-exponent * std::log(x));
+} // end h
+
+double ZipfGenerator::hIntegral(double x) const
+{
+	double logX = std::log(x);
+	return expm1OverX((1.0 - exponent) * logX) * logX;
+} // end hIntegral
+
+double ZipfGenerator::hIntegralInverse(double x) const
+{
+	double t = x * (1.0 - exponent);
+	if (t < -1.0)
+		t = -1.0; // end if-else
+	return std::exp(log1pOverX(t) * x);
+} // end hIntegralInverse
+
+int ZipfGenerator::next(std::mt19937& engine)
+{
+	std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+	while (true)
+	{
+		double u = hIntegralNumberOfElements + uniform(engine) * (hIntegralX1 - hIntegralNumberOfElements);
+		double x = hIntegralInverse(u);
+		int k = static_cast<int>(x + 0.5);
+
+		if (k < 1)
+			k = 1;
+		else if (k > numberOfElements)
+			k = numberOfElements; // end if-else
+
+		if (k - x <= squeeze || u >= hIntegral(k + 0.5) - h(k))
+			return k; // end if-else
+	} // end while
+} // end next
+
+// -------------------------------------------------------------------------------------
+// Workload Section.
+// -------------------------------------------------------------------------------------
+
+namespace
+{
+	// Spreads Zipfian ranks over the key space so that the hottest keys are
+	// not also the smallest ones.
+	int scrambleRank(int rank)
+	{
+		return static_cast<int>((static_cast<std::uint32_t>(rank) * 2654435761u) >> 1);
+	} // end scrambleRank
+} // end namespace
+
+std::vector<Workload> getAllWorkloads()
+{
+	return { Workload::Random, Workload::Sorted, Workload::Reverse, Workload::Duplicates,
+		Workload::Zipfian };
+} // end getAllWorkloads
+
+const char* getWorkloadName(Workload workload)
+{
+	switch (workload)
+	{
+	case Workload::Random:		return "random";
+	case Workload::Sorted:		return "sorted";
+	case Workload::Reverse:		return "reverse";
+	case Workload::Duplicates:	return "duplicates";
+	case Workload::Zipfian:		return "zipfian";
+	} // end switch
+
+	return "unknown";
+} // end getWorkloadName
+
+bool isDegenerateWorkload(Workload workload)
+{
+	// Sorted input makes a chain, and the hot keys of a Zipfian workload
+	// make long chains of equal entries.
+	return workload == Workload::Sorted || workload == Workload::Reverse
+		|| workload == Workload::Zipfian;
+} // end isDegenerateWorkload
+
+std::vector<int> makeKeys(Workload workload, int count, std::uint32_t seed)
+{
+	std::mt19937 engine(seed);
+	std::vector<int> keys(count);
+
+	switch (workload)
+	{
+	case Workload::Random:
+		std::iota(keys.begin(), keys.end(), 0);
+		std::shuffle(keys.begin(), keys.end(), engine);
+		break;
+	case Workload::Sorted:
+		std::iota(keys.begin(), keys.end(), 0);
+		break;
+	case Workload::Reverse:
+		for (int i = 0; i < count; ++i)
+			keys[i] = count - 1 - i; // end for
+		break;
+	case Workload::Duplicates:
+	{
+		std::uniform_int_distribution<int> distribution(0, std::max(1, count / 64) - 1);
+		for (int& key : keys)
+			key = distribution(engine); // end for
+		break;
+	}
+	case Workload::Zipfian:
+	{
+		ZipfGenerator generator(count, 0.99);
+		for (int& key : keys)
+			key = scrambleRank(generator.next(engine)); // end for
+		break;
+	}
+	} // end switch
+
+	return keys;
+} // end makeKeys
+
+std::vector<int> makeLookups(Workload workload, const std::vector<int>& keys, int count,
+	std::uint32_t seed)
+{
+	std::mt19937 engine(seed);
+	std::vector<int> lookups(count);
+
+	if (workload == Workload::Zipfian)
+	{
+		ZipfGenerator generator(static_cast<int>(keys.size()), 0.99);
+		for (int& key : lookups)
+			key = scrambleRank(generator.next(engine)); // end for
+	}
+	else
+	{
+		std::uniform_int_distribution<std::size_t> distribution(0, keys.size() - 1);
+		for (int& key : lookups)
+			key = keys[distribution(engine)]; // end for
+	} // end if-else
+
+	return lookups;
+} // end makeLookups
+
+std::vector<int> makeSkewedLookups(const std::vector<int>& keys, int count, double exponent,
+	std::uint32_t seed)
+{
+	std::mt19937 engine(seed);
+	std::vector<int> byPopularity(keys);
+	std::shuffle(byPopularity.begin(), byPopularity.end(), engine);
+
+	ZipfGenerator generator(static_cast<int>(keys.size()), exponent);
+	std::vector<int> lookups(count);
+	for (int& key : lookups)
+		key = byPopularity[generator.next(engine) - 1]; // end for
+
+	return lookups;
+} // end makeSkewedLookups
+
+// -------------------------------------------------------------------------------------
+// Options and Output Section.
+// -------------------------------------------------------------------------------------
+
+namespace
+{
+	void printUsage(const char* programName)
+	{
+		std::cerr << "Usage: " << programName << " [--min-keys N] [--max-keys N]"
+			<< " [--max-lookups N] [--filter NAME]\n";
+	} // end printUsage
+} // end namespace
+
+BenchmarkOptions parseOptions(int argc, char* argv[])
+{
+	BenchmarkOptions options = { 1000, 10000000, 1000000, "" };
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+		if (i + 1 >= argc)
+		{
+			printUsage(argv[0]);
+			std::exit(1);
+		} // end if-else
+
+		std::string value = argv[++i];
+		if (argument == "--min-keys")
+			options.minKeys = std::atoi(value.c_str());
+		else if (argument == "--max-keys")
+			options.maxKeys = std::atoi(value.c_str());
+		else if (argument == "--max-lookups")
+			options.maxLookups = std::atoi(value.c_str());
+		else if (argument == "--filter")
+			options.filter = value;
+		else
+		{
+			printUsage(argv[0]);
+			std::exit(1);
+		} // end if-else
+	} // end for
+
+	if (options.minKeys < 1 || options.maxKeys < options.minKeys || options.maxLookups < 1)
+	{
+		printUsage(argv[0]);
+		std::exit(1);
+	} // end if-else
+
+	return options;
+} // end parseOptions
+
+std::vector<int> getKeyCounts(const BenchmarkOptions& options)
+{
+	std::vector<int> keyCounts;
+	for (long long count = options.minKeys; count <= options.maxKeys; count *= 10)
+		keyCounts.push_back(static_cast<int>(count)); // end for
+	return keyCounts;
+} // end getKeyCounts
+
+int getRounds(int count)
+{
+	return std::max(1, 1000000 / count);
+} // end getRounds
+
+void printHeader()
+{
+	std::cout << std::left << std::setw(22) << "structure" << std::setw(12) << "workload"
+		<< std::right << std::setw(10) << "keys" << "  " << std::left << std::setw(12) << "operation"
+		<< std::right << std::setw(12) << "ns/op" << std::setw(12) << "allocs/op"
+		<< std::setw(8) << "height" << "\n";
+} // end printHeader
+
+void printResult(const std::string& structure, const char* workload, int keys,
+	const char* operation, double nanosecondsPerOperation, double allocationsPerOperation,
+	int height)
+{
+	std::cout << std::left << std::setw(22) << structure << std::setw(12) << workload
+		<< std::right << std::setw(10) << keys << "  " << std::left << std::setw(12) << operation
+		<< std::right << std::fixed << std::setprecision(1) << std::setw(12) << nanosecondsPerOperation
+		<< std::setprecision(4) << std::setw(12) << allocationsPerOperation
+		<< std::setw(8) << height << "\n" << std::flush;
+} // end printResult
+
+void printMeasurement(const std::string& structure, const char* workload, int keys,
+	const char* operation, const Measurement& measurement, int height)
+{
+	double operations = static_cast<double>(std::max(1LL, measurement.operations));
+	printResult(structure, workload, keys, operation, measurement.nanoseconds / operations,
+		measurement.allocations / operations, height);
+} // end printMeasurement
+
+void printMemory(const std::string& structure, const char* workload, int keys, long long bytesReserved,
+	int height)
+{
+	std::cout << std::left << std::setw(22) << structure << std::setw(12) << workload
+		<< std::right << std::setw(10) << keys << "  " << std::left << std::setw(12) << "memory"
+		<< std::right << std::fixed << std::setprecision(1) << std::setw(12)
+		<< static_cast<double>(bytesReserved) / std::max(1, keys) << std::setw(12) << "bytes/key"
+		<< std::setw(8) << height << "\n" << std::flush;
+} // end printMemory
+
+void printSkipped(const std::string& structure, const char* workload, int keys, const char* reason)
+{
+	std::cout << std::left << std::setw(22) << structure << std::setw(12) << workload
+		<< std::right << std::setw(10) << keys << "  " << "skipped: " << reason << "\n" << std::flush;
+} // end printSkipped
@@ -0,0 +1,277 @@
+/**
+This file provides the support shared by the benchmark programs: an
+allocation counter, a stopwatch, the key workloads, a Zipfian key
+generator, the command line options and the result table.
+
+@author		Solomon Colley
+@file		BenchmarkSupport.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+Returns the number of calls made to the global operator new since the
+program started. BenchmarkSupport.cpp replaces operator new to count them.
+@return		The number of allocations made so far.
+*/
+long long getAllocationCount();
+
+/**
+Keeps a value alive so that the compiler cannot remove the work that
+computed it.
+@param		long long value
+@return		void
+*/
+void doNotOptimize(long long value);
+
+/**
+Measures elapsed wall clock time with a monotonic clock.
+*/
+class Stopwatch
+{
+private:
+	std::int64_t startNanoseconds;	// Time at which the stopwatch was started.
+
+public:
+	Stopwatch();
+
+	/**
+	Restarts the stopwatch at the current time.
+	@return		void
+	*/
+	void restart();
+
+	/**
+	Returns the time elapsed since the stopwatch was last started.
+	@return		The elapsed time in nanoseconds.
+	*/
+	std::int64_t getElapsedNanoseconds() const;
+}; // end Stopwatch
+
+/**
+The time and allocations accumulated over one or more timed runs of an
+operation.
+*/
+struct Measurement
+{
+	std::int64_t nanoseconds = 0;	// Total time spent in the timed runs.
+	long long allocations = 0;		// Total calls to operator new in the timed runs.
+	long long operations = 0;		// Total operations performed in the timed runs.
+}; // end Measurement
+
+/**
+Runs action once, adding its elapsed time, its allocations and the given
+number of operations to measurement.
+@param		Measurement& measurement
+@param		long long operations
+@param		Action&& action
+@return		void
+*/
+template<class Action>
+void timeAction(Measurement& measurement, long long operations, Action&& action)
+{
+	long long allocationsBefore = getAllocationCount();
+	Stopwatch stopwatch;
+	action();
+	measurement.nanoseconds += stopwatch.getElapsedNanoseconds();
+	measurement.allocations += getAllocationCount() - allocationsBefore;
+	measurement.operations += operations;
+} // end timeAction
+
+/**
+Draws integers in [1, n] with probability proportional to 1 / k^s using
+rejection-inversion sampling, which needs O(1) memory and time per draw
+regardless of n.
+*/
+class ZipfGenerator
+{
+private:
+	int numberOfElements;			// Largest value that can be drawn.
+	double exponent;				// Skew s of the distribution.
+	double hIntegralX1;				// hIntegral(1.5) - 1.
+	double hIntegralNumberOfElements;	// hIntegral(n + 0.5).
+	double squeeze;					// Acceptance bound that avoids most rejections.
+
+	double h(double x) const;
+	double hIntegral(double x) const;
+	double hIntegralInverse(double x) const;
+
+public:
+	ZipfGenerator(int numberOfElements, double exponent);
+
+	/**
+	Draws the next value from the distribution.
+	@param		std::mt19937& engine
+	@return		A value in [1, numberOfElements]; 1 is the most frequent.
+	*/
+	int next(std::mt19937& engine);
+}; // end ZipfGenerator
+
+/**
+The key orders and distributions the benchmarks are run against.
+*/
+enum class Workload
+{
+	Random,		// A random permutation of distinct keys.
+	Sorted,		// Distinct keys in ascending order.
+	Reverse,	// Distinct keys in descending order.
+	Duplicates,	// Random keys in which each value occurs about 64 times.
+	Zipfian		// Keys drawn from a Zipfian distribution with s = 0.99.
+}; // end Workload
+
+/**
+Returns every workload in the order in which the benchmarks report them.
+@return		A vector of all workloads.
+*/
+std::vector<Workload> getAllWorkloads();
+
+/**
+Returns the name of the given workload as printed in the result table.
+@param		Workload workload
+@return		The name of the workload.
+*/
+const char* getWorkloadName(Workload workload);
+
+/**
+Returns whether the given workload turns an unbalanced binary search
+tree into long chains, which makes building it take quadratic time.
+@param		Workload workload
+@return		True if the workload degrades an unbalanced tree.
+*/
+bool isDegenerateWorkload(Workload workload);
+
+/**
+Generates the keys to insert for the given workload.
+@param		Workload workload
+@param		int count
+@param		std::uint32_t seed
+@return		A vector of count keys in insertion order.
+*/
+std::vector<int> makeKeys(Workload workload, int count, std::uint32_t seed);
+
+/**
+Generates the keys to look up for the given workload. Zipfian lookups are
+drawn from the same skewed distribution as the keys; the other workloads
+look up inserted keys chosen uniformly at random.
+@param		Workload workload
+@param		const std::vector<int>& keys
+@param		int count
+@param		std::uint32_t seed
+@return		A vector of count keys to look up.
+*/
+std::vector<int> makeLookups(Workload workload, const std::vector<int>& keys, int count,
+	std::uint32_t seed);
+
+/**
+Generates lookups of the given keys whose popularity follows a Zipf
+distribution with the given exponent: the key at a random position of
+keys is the most popular, and so on down. An exponent of 0 looks up all
+keys alike, and larger exponents put more of the lookups on fewer keys.
+@param		const std::vector<int>& keys
+@param		int count
+@param		double exponent
+@param		std::uint32_t seed
+@return		A vector of count keys to look up.
+*/
+std::vector<int> makeSkewedLookups(const std::vector<int>& keys, int count, double exponent,
+	std::uint32_t seed);
+
+/**
+The command line options shared by the benchmarks.
+*/
+struct BenchmarkOptions
+{
+	int minKeys;		// Smallest number of keys to benchmark.
+	int maxKeys;		// Largest number of keys to benchmark.
+	int maxLookups;		// Upper bound on the lookups timed per size.
+	std::string filter;	// Only structures whose name contains this are run.
+}; // end BenchmarkOptions
+
+/**
+Parses --min-keys N, --max-keys N, --max-lookups N and --filter NAME.
+Unknown arguments print the usage and end the program.
+@param		int argc
+@param		char* argv[]
+@return		The parsed options.
+*/
+BenchmarkOptions parseOptions(int argc, char* argv[]);
+
+/**
+Returns the sizes to benchmark: every power of ten from minKeys up to
+maxKeys.
+@param		const BenchmarkOptions& options
+@return		A vector of key counts in ascending order.
+*/
+std::vector<int> getKeyCounts(const BenchmarkOptions& options);
+
+/**
+Returns how many times a measurement over count items should be repeated
+so that each size does a comparable amount of work.
+@param		int count
+@return		The number of rounds, at least 1.
+*/
+int getRounds(int count);
+
+/**
+Prints the column headings of the result table.
+@return		void
+*/
+void printHeader();
+
+/**
+Prints one row of the result table.
+@param		const std::string& structure
+@param		const char* workload
+@param		int keys
+@param		const char* operation
+@param		double nanosecondsPerOperation
+@param		double allocationsPerOperation
+@param		int height
+@return		void
+*/
+void printResult(const std::string& structure, const char* workload, int keys,
+	const char* operation, double nanosecondsPerOperation, double allocationsPerOperation,
+	int height);
+
+/**
+Prints one row of the result table with the per-operation averages of
+the given measurement.
+@param		const std::string& structure
+@param		const char* workload
+@param		int keys
+@param		const char* operation
+@param		const Measurement& measurement
+@param		int height
+@return		void
+*/
+void printMeasurement(const std::string& structure, const char* workload, int keys,
+	const char* operation, const Measurement& measurement, int height);
+
+/**
+Prints a row with the bytes of node memory a tree holds per key added
+to it, in place of the time and allocations of an operation.
+@param		const std::string& structure
+@param		const char* workload
+@param		int keys
+@param		long long bytesReserved
+@param		int height
+@return		void
+*/
+void printMemory(const std::string& structure, const char* workload, int keys, long long bytesReserved,
+	int height);
+
+/**
+Prints a row noting that a combination was not run.
+@param		const std::string& structure
+@param		const char* workload
+@param		int keys
+@param		const char* reason
+@return		void
+*/
+void printSkipped(const std::string& structure, const char* workload, int keys, const char* reason);
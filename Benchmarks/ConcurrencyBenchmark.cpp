@@ -0,0 +1,185 @@
+/**
+This program benchmarks lookups mixed with updates from many threads at
+once. It compares a ConcurrentSearchTree, whose readers take no locks, and
+a LockFreeSearchTree, which takes no locks at all, with a
+BinarySearchTree behind one mutex. For each tree size, read share
+and thread count it reports the wall clock time per operation over all
+threads and the resulting throughput.
+
+@author		Solomon Colley
+@file		ConcurrencyBenchmark.cpp
+@since		10/18/2026
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchmarkSupport.h"
+#include "BinarySearchTree.h"
+#include "ConcurrentSearchTree.h"
+#include "LockFreeSearchTree.h"
+
+namespace
+{
+	const int THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };	// Threads per run.
+	const int READ_PERCENTAGES[] = { 95, 50 };				// Share of lookups in each mix.
+
+	/**
+	A BinarySearchTree guarded by one mutex, the way a tree is shared
+	between threads without a concurrent tree.
+	*/
+	class LockedSearchTree
+	{
+	private:
+		BinarySearchTree<int> tree;		// The shared tree.
+		mutable std::mutex treeMutex;	// Held for every operation.
+
+	public:
+		bool add(int newEntry)
+		{
+			std::lock_guard<std::mutex> lock(treeMutex);
+			return tree.add(newEntry);
+		} // end add
+
+		bool remove(int anEntry)
+		{
+			std::lock_guard<std::mutex> lock(treeMutex);
+			return tree.remove(anEntry);
+		} // end remove
+
+		bool contains(int anEntry) const
+		{
+			std::lock_guard<std::mutex> lock(treeMutex);
+			return tree.contains(anEntry);
+		} // end contains
+	}; // end LockedSearchTree
+
+	/**
+	Prints the column headings of the result table.
+	@return		void
+	*/
+	void printConcurrencyHeader()
+	{
+		std::cout << std::left << std::setw(22) << "structure" << std::setw(10) << "mix"
+			<< std::right << std::setw(10) << "keys" << std::setw(9) << "threads"
+			<< std::setw(12) << "ns/op" << std::setw(12) << "Mops/s" << "\n";
+	} // end printConcurrencyHeader
+
+	/**
+	Runs operationCount operations split evenly over threadCount threads,
+	all started at once. A thread looks up a random key with probability
+	readPercentage / 100; otherwise it removes the key, or adds it if it
+	was absent, which keeps the size of the tree about the same.
+	@param		Tree& tree
+	@param		int keyRange
+	@param		int threadCount
+	@param		int readPercentage
+	@param		long long operationCount
+	@return		The elapsed time in nanoseconds.
+	*/
+	template<class Tree>
+	std::int64_t runMix(Tree& tree, int keyRange, int threadCount, int readPercentage,
+		long long operationCount)
+	{
+		std::atomic<int> readyThreads(0);
+		std::atomic<bool> isStarted(false);
+		std::atomic<long long> hits(0);
+		long long operationsPerThread = operationCount / threadCount;
+
+		std::vector<std::thread> threads;
+		for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]()
+			{
+				std::mt19937 engine(1000 + threadIndex);
+				std::uniform_int_distribution<int> keyDistribution(0, keyRange - 1);
+				std::uniform_int_distribution<int> percentDistribution(0, 99);
+				long long localHits = 0;
+
+				readyThreads.fetch_add(1);
+				while (!isStarted.load(std::memory_order_acquire))
+					std::this_thread::yield(); // end while
+
+				for (long long i = 0; i < operationsPerThread; ++i)
+				{
+					int key = keyDistribution(engine);
+					if (percentDistribution(engine) < readPercentage)
+						localHits += tree.contains(key) ? 1 : 0;
+					else if (!tree.remove(key))
+						tree.add(key); // end if-else
+				} // end for
+
+				hits.fetch_add(localHits);
+			});
+		} // end for
+
+		while (readyThreads.load() < threadCount)
+			std::this_thread::yield(); // end while
+
+		Stopwatch stopwatch;
+		isStarted.store(true, std::memory_order_release);
+		for (std::thread& thread : threads)
+			thread.join(); // end for
+		std::int64_t elapsed = stopwatch.getElapsedNanoseconds();
+
+		doNotOptimize(hits.load());
+		return elapsed;
+	} // end runMix
+
+	/**
+	Benchmarks one tree type at every size, read share and thread count.
+	Each size starts from a tree holding a random half of the key range.
+	@param		const std::string& structure
+	@param		const BenchmarkOptions& options
+	@return		void
+	*/
+	template<class Tree>
+	void runStructure(const std::string& structure, const BenchmarkOptions& options)
+	{
+		if (structure.find(options.filter) == std::string::npos)
+			return; // end if-else
+
+		for (int keyCount : getKeyCounts(options))
+		{
+			std::vector<int> keys = makeKeys(Workload::Random, 2 * keyCount, 42);
+			Tree tree;
+			for (int i = 0; i < keyCount; ++i)
+				tree.add(keys[i]); // end for
+
+			for (int readPercentage : READ_PERCENTAGES)
+			{
+				std::string mix = std::to_string(readPercentage) + "/" + std::to_string(100 - readPercentage);
+				for (int threadCount : THREAD_COUNTS)
+				{
+					long long operationCount = options.maxLookups - options.maxLookups % threadCount;
+					std::int64_t elapsed = runMix(tree, 2 * keyCount, threadCount, readPercentage,
+						operationCount);
+
+					double nanosecondsPerOperation = static_cast<double>(elapsed) / operationCount;
+					std::cout << std::left << std::setw(22) << structure << std::setw(10) << mix
+						<< std::right << std::setw(10) << keyCount << std::setw(9) << threadCount
+						<< std::fixed << std::setprecision(1) << std::setw(12) << nanosecondsPerOperation
+						<< std::setprecision(2) << std::setw(12) << 1000.0 / nanosecondsPerOperation
+						<< "\n" << std::flush;
+				} // end for
+			} // end for
+		} // end for
+	} // end runStructure
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+	BenchmarkOptions options = parseOptions(argc, argv);
+
+	printConcurrencyHeader();
+	runStructure<LockedSearchTree>("LockedSearchTree", options);
+	runStructure<ConcurrentSearchTree<int>>("ConcurrentSearchTree", options);
+	runStructure<LockFreeSearchTree<int>>("LockFreeSearchTree", options);
+	return 0;
+} // end main
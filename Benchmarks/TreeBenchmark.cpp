@@ -0,0 +1,696 @@
+/**
+This program benchmarks the basic operations of the binary search trees
+over several key workloads and sizes. For each combination it reports
+the average time and the number of heap allocations per operation and
+the height of the tree the operation worked on.
+
+@author		Solomon Colley
+@file		TreeBenchmark.cpp
+@since		10/18/2026
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "AVLTree.h"
+#include "BTree.h"
+#include "BenchmarkSupport.h"
+#include "BinarySearchTree.h"
+#include "FrozenSearchTree.h"
+#include "MappedSearchTree.h"
+#include "MultisetSearchTree.h"
+#include "PersistentSearchTree.h"
+#include "SplayTree.h"
+
+namespace
+{
+	const int DEGENERATE_KEY_LIMIT = 10000;	// Largest degenerate workload run on an unbalanced tree.
+	const int RANGE_WIDTH = 100;			// Width of the key windows visited by the range benchmark.
+	const int BATCH_SIZES[] = { 16, 256, 4096, 65536 };	// Keys per call in the batched lookup benchmark.
+	const int MAX_SPLITS = 1000;			// Largest number of splits timed per round.
+	const int MERGE_DIVISOR = 100;			// A merged tree holds this fraction of the keys.
+	const double LOOKUP_SKEWS[] = { 0.0, 0.8, 0.99, 1.2, 1.5 };	// Zipf exponents of the skewed lookups.
+	const int WIDE_ENTRY_SIZE = 256;		// Bytes in each entry of the wide traversal benchmark.
+	const int WIDE_KEY_LIMIT = 1000000;		// Largest tree of wide entries that is built.
+
+	long long visitedSum = 0;	// Accumulates the entries seen by addToVisitedSum.
+
+	void addToVisitedSum(int& anEntry)
+	{
+		visitedSum += anEntry;
+	} // end addToVisitedSum
+
+	/**
+	An entry of WIDE_ENTRY_SIZE bytes ordered by its key, which is costly
+	to copy into a temporary for every node a traversal visits.
+	*/
+	struct WideEntry
+	{
+		int key;										// Value the entries are ordered by.
+		char payload[WIDE_ENTRY_SIZE - sizeof(int)];	// Bytes carried along with the key.
+	}; // end WideEntry
+
+	bool operator==(const WideEntry& left, const WideEntry& right)
+	{
+		return left.key == right.key;
+	} // end operator==
+
+	bool operator<(const WideEntry& left, const WideEntry& right)
+	{
+		return left.key < right.key;
+	} // end operator<
+
+	void addWideToVisitedSum(WideEntry& anEntry)
+	{
+		visitedSum += anEntry.key;
+	} // end addWideToVisitedSum
+
+	/**
+	Tells the benchmarks whether Tree is a BinarySearchTree, which has the
+	batched lookups, order statistics, range queries, snapshots and bulk
+	loading that other tree types lack.
+	*/
+	template<class Tree>
+	struct IsSearchTree : std::is_base_of<BinarySearchTree<int>, Tree>
+	{
+	}; // end IsSearchTree
+
+	/**
+	Tells the benchmarks whether Tree is built on BinaryNodeTree, which has
+	the parallel traversal and reduction.
+	*/
+	template<class Tree>
+	struct IsNodeTree : std::is_base_of<BinaryNodeTree<int>, Tree>
+	{
+	}; // end IsNodeTree
+
+	/**
+	Tells the benchmarks whether Tree is a MultisetSearchTree, which counts
+	the occurrences of an entry in one node.
+	*/
+	template<class Tree>
+	struct IsMultisetTree : std::is_same<MultisetSearchTree<int>, Tree>
+	{
+	}; // end IsMultisetTree
+
+	/**
+	Tells the benchmarks whether Tree implements BinaryTreeInterface, whose
+	traversals take a function that may change the entries.
+	*/
+	template<class Tree>
+	struct IsInterfaceTree : std::is_base_of<BinaryTreeInterface<int>, Tree>
+	{
+	}; // end IsInterfaceTree
+
+	/**
+	Benchmarks the queries that only a BinarySearchTree offers on a tree
+	built from one workload.
+	@param		const std::string& structure
+	@param		const char* workloadName
+	@param		int keyCount
+	@param		int rounds
+	@param		const Tree& tree
+	@param		const std::vector<int>& lookups
+	@return		void
+	*/
+	template<class Tree>
+	void runSearchTreeQueries(const std::string& structure, const char* workloadName, int keyCount,
+		int rounds, const Tree& tree, const std::vector<int>& lookups)
+	{
+		int height = tree.getHeight();
+
+		// Look up the same keys with containsBatch, cut into batches of each
+		// size. The time is reported per key, so it compares directly with
+		// the contains row above.
+		std::vector<char> found(lookups.size());
+		for (int batchSize : BATCH_SIZES)
+		{
+			if (batchSize > static_cast<int>(lookups.size()))
+				break; // end if-else
+
+			Measurement batchLookup;
+			long long batchHits = 0;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(batchLookup, static_cast<long long>(lookups.size()), [&]()
+				{
+					for (std::size_t start = 0; start < lookups.size(); start += batchSize)
+					{
+						std::size_t stop = std::min(lookups.size(), start + batchSize);
+						tree.containsBatch(lookups.begin() + start, lookups.begin() + stop,
+							found.begin() + start);
+					} // end for
+				});
+				for (char isFound : found)
+					batchHits += isFound; // end for
+			} // end for
+			doNotOptimize(batchHits);
+
+			std::string operation = "batch-" + std::to_string(batchSize);
+			printMeasurement(structure, workloadName, keyCount, operation.c_str(), batchLookup, height);
+		} // end for
+
+		Measurement ranking;
+		long long rankSum = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(ranking, static_cast<long long>(lookups.size()), [&]()
+			{
+				for (int key : lookups)
+					rankSum += tree.rank(key); // end for
+			});
+		} // end for
+		doNotOptimize(rankSum);
+		printMeasurement(structure, workloadName, keyCount, "rank", ranking, height);
+
+		Measurement selection;
+		long long selectSum = 0;
+		std::vector<int> positions(lookups.size());
+		std::mt19937 positionEngine(4);
+		std::uniform_int_distribution<int> positionDistribution(0, keyCount - 1);
+		for (int& position : positions)
+			position = positionDistribution(positionEngine); // end for
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(selection, static_cast<long long>(positions.size()), [&]()
+			{
+				for (int position : positions)
+					selectSum += tree.select(position); // end for
+			});
+		} // end for
+		doNotOptimize(selectSum);
+		printMeasurement(structure, workloadName, keyCount, "select", selection, height);
+
+		// Visit the entries in windows that start at the lookup keys and span
+		// about RANGE_WIDTH keys of the random, sorted and reverse workloads.
+		Measurement rangeQuery;
+		long long rangeSum = 0;
+		std::size_t rangeCount = std::max<std::size_t>(1, lookups.size() / RANGE_WIDTH);
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(rangeQuery, static_cast<long long>(rangeCount), [&]()
+			{
+				for (std::size_t i = 0; i < rangeCount; ++i)
+					tree.forEachInRange(lookups[i], lookups[i] + RANGE_WIDTH,
+						[&rangeSum](const int& anEntry) { rangeSum += anEntry; }); // end for
+			});
+		} // end for
+		doNotOptimize(rangeSum);
+		printMeasurement(structure, workloadName, keyCount, "range", rangeQuery, height);
+
+		// Freeze the tree into an Eytzinger snapshot, reusing its memory after
+		// the first round, and repeat the lookups and range queries on it.
+		FrozenSearchTree<int> snapshot;
+		Measurement freezing;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(freezing, keyCount, [&]()
+			{
+				tree.freeze(snapshot);
+			});
+		} // end for
+		printMeasurement(structure, workloadName, keyCount, "freeze", freezing, snapshot.getHeight());
+
+		Measurement frozenLookup;
+		long long frozenHits = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(frozenLookup, static_cast<long long>(lookups.size()), [&]()
+			{
+				for (int key : lookups)
+					frozenHits += snapshot.contains(key) ? 1 : 0; // end for
+			});
+		} // end for
+		doNotOptimize(frozenHits);
+		printMeasurement(structure, workloadName, keyCount, "frz-contains", frozenLookup, snapshot.getHeight());
+
+		Measurement frozenBatch;
+		long long frozenBatchHits = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(frozenBatch, static_cast<long long>(lookups.size()), [&]()
+			{
+				snapshot.containsBatch(lookups.begin(), lookups.end(), found.begin());
+			});
+			for (char isFound : found)
+				frozenBatchHits += isFound; // end for
+		} // end for
+		doNotOptimize(frozenBatchHits);
+		printMeasurement(structure, workloadName, keyCount, "frz-batch", frozenBatch, snapshot.getHeight());
+
+		Measurement frozenRange;
+		long long frozenRangeSum = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(frozenRange, static_cast<long long>(rangeCount), [&]()
+			{
+				for (std::size_t i = 0; i < rangeCount; ++i)
+					snapshot.forEachInRange(lookups[i], lookups[i] + RANGE_WIDTH,
+						[&frozenRangeSum](const int& anEntry) { frozenRangeSum += anEntry; }); // end for
+			});
+		} // end for
+		doNotOptimize(frozenRangeSum);
+		printMeasurement(structure, workloadName, keyCount, "frz-range", frozenRange, snapshot.getHeight());
+
+		// Write the tree as a file image, then map it and repeat the lookups
+		// and range queries on the mapped pages. Opening is timed per open,
+		// without unmapping the previous round.
+		std::string fileName = (std::filesystem::temp_directory_path() / "bst_benchmark.image").string();
+		Measurement imageWriting;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(imageWriting, keyCount, [&]()
+			{
+				tree.saveImage(fileName);
+			});
+		} // end for
+
+		MappedSearchTree<int> mapped;
+		Measurement imageOpening;
+		for (int round = 0; round < rounds; ++round)
+		{
+			mapped.close();
+			timeAction(imageOpening, 1, [&]()
+			{
+				mapped.open(fileName);
+			});
+		} // end for
+		printMeasurement(structure, workloadName, keyCount, "map-write", imageWriting, mapped.getHeight());
+		printMeasurement(structure, workloadName, keyCount, "map-open", imageOpening, mapped.getHeight());
+
+		Measurement mappedLookup;
+		long long mappedHits = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(mappedLookup, static_cast<long long>(lookups.size()), [&]()
+			{
+				for (int key : lookups)
+					mappedHits += mapped.contains(key) ? 1 : 0; // end for
+			});
+		} // end for
+		doNotOptimize(mappedHits);
+		printMeasurement(structure, workloadName, keyCount, "map-contains", mappedLookup, mapped.getHeight());
+
+		Measurement mappedRange;
+		long long mappedRangeSum = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(mappedRange, static_cast<long long>(rangeCount), [&]()
+			{
+				for (std::size_t i = 0; i < rangeCount; ++i)
+					mapped.forEachInRange(lookups[i], lookups[i] + RANGE_WIDTH,
+						[&mappedRangeSum](const int& anEntry) { mappedRangeSum += anEntry; }); // end for
+			});
+		} // end for
+		doNotOptimize(mappedRangeSum);
+		printMeasurement(structure, workloadName, keyCount, "map-range", mappedRange, mapped.getHeight());
+
+		mapped.close();
+		std::remove(fileName.c_str());
+	} // end runSearchTreeQueries
+
+	/**
+	Benchmarks every operation of one tree type on one workload and size.
+	@param		const std::string& structure
+	@param		Workload workload
+	@param		int keyCount
+	@param		int rounds
+	@param		const BenchmarkOptions& options
+	@return		void
+	*/
+	template<class Tree>
+	void runWorkload(const std::string& structure, Workload workload, int keyCount, int rounds,
+		const BenchmarkOptions& options)
+	{
+		const char* workloadName = getWorkloadName(workload);
+		std::vector<int> keys = makeKeys(workload, keyCount, 1);
+		std::vector<int> lookups = makeLookups(workload, keys, std::min(keyCount, options.maxLookups), 2);
+		std::vector<int> removals = keys;
+		std::shuffle(removals.begin(), removals.end(), std::mt19937(3));
+
+		// Build the tree by adding the keys one at a time.
+		Tree tree;
+		Measurement addition;
+		for (int round = 0; round < rounds; ++round)
+		{
+			Tree built;
+			timeAction(addition, keyCount, [&]()
+			{
+				for (int key : keys)
+					built.add(key); // end for
+			});
+			tree = std::move(built);
+		} // end for
+		int height = tree.getHeight();
+		printMeasurement(structure, workloadName, keyCount, "add", addition, height);
+		if constexpr (IsNodeTree<Tree>::value || IsMultisetTree<Tree>::value)
+			printMemory(structure, workloadName, keyCount, tree.getAllocatorStatistics().bytesReserved,
+				height); // end if-else
+
+		Measurement lookup;
+		long long hits = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(lookup, static_cast<long long>(lookups.size()), [&]()
+			{
+				for (int key : lookups)
+					hits += tree.contains(key) ? 1 : 0; // end for
+			});
+		} // end for
+		doNotOptimize(hits);
+		printMeasurement(structure, workloadName, keyCount, "contains", lookup, height);
+
+		if constexpr (IsMultisetTree<Tree>::value)
+		{
+			Measurement counting;
+			long long occurrences = 0;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(counting, static_cast<long long>(lookups.size()), [&]()
+				{
+					for (int key : lookups)
+						occurrences += tree.count(key); // end for
+				});
+			} // end for
+			doNotOptimize(occurrences);
+			printMeasurement(structure, workloadName, keyCount, "count", counting, height);
+		} // end if-else
+
+		if constexpr (IsSearchTree<Tree>::value)
+			runSearchTreeQueries(structure, workloadName, keyCount, rounds, tree, lookups); // end if-else
+
+		Measurement visitorTraversal;
+		long long sum = 0;
+		for (int round = 0; round < rounds; ++round)
+		{
+			timeAction(visitorTraversal, keyCount, [&]()
+			{
+				tree.inorderTraverse([&sum](const int& anEntry) { sum += anEntry; });
+			});
+		} // end for
+		doNotOptimize(sum);
+		printMeasurement(structure, workloadName, keyCount, "inorder", visitorTraversal, height);
+
+		if constexpr (IsInterfaceTree<Tree>::value)
+		{
+			Measurement pointerTraversal;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(pointerTraversal, keyCount, [&]()
+				{
+					tree.inorderTraverse(addToVisitedSum);
+				});
+			} // end for
+			doNotOptimize(visitedSum);
+			printMeasurement(structure, workloadName, keyCount, "inorder-fn", pointerTraversal, height);
+		} // end if-else
+
+		if constexpr (IsNodeTree<Tree>::value)
+		{
+			Measurement parallelVisit;
+			std::atomic<long long> parallelSum(0);
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(parallelVisit, keyCount, [&]()
+				{
+					tree.parallelForEach([&parallelSum](const int& anEntry)
+					{
+						parallelSum.fetch_add(anEntry, std::memory_order_relaxed);
+					});
+				});
+			} // end for
+			doNotOptimize(parallelSum.load());
+			printMeasurement(structure, workloadName, keyCount, "par-foreach", parallelVisit, height);
+
+			Measurement parallelReduction;
+			long long reducedSum = 0;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(parallelReduction, keyCount, [&]()
+				{
+					reducedSum += tree.parallelReduce([](const int& anEntry) { return static_cast<long long>(anEntry); },
+						[](long long leftSum, long long rightSum) { return leftSum + rightSum; });
+				});
+			} // end for
+			doNotOptimize(reducedSum);
+			printMeasurement(structure, workloadName, keyCount, "par-reduce", parallelReduction, height);
+		} // end if-else
+
+		Measurement copying;
+		for (int round = 0; round < rounds; ++round)
+		{
+			std::optional<Tree> copy;
+			timeAction(copying, keyCount, [&]()
+			{
+				copy.emplace(tree);
+			});
+		} // end for
+		printMeasurement(structure, workloadName, keyCount, "copy", copying, height);
+
+		Measurement removal;
+		for (int round = 0; round < rounds; ++round)
+		{
+			Tree victim(tree);
+			timeAction(removal, keyCount, [&]()
+			{
+				for (int key : removals)
+					victim.remove(key); // end for
+			});
+		} // end for
+		printMeasurement(structure, workloadName, keyCount, "remove", removal, height);
+
+		if constexpr (IsSearchTree<Tree>::value)
+		{
+			Measurement bulkLoad;
+			int loadedHeight = 0;
+			for (int round = 0; round < rounds; ++round)
+			{
+				Tree loaded;
+				timeAction(bulkLoad, keyCount, [&]()
+				{
+					loaded.assign(keys.begin(), keys.end());
+				});
+				loadedHeight = loaded.getHeight();
+			} // end for
+			printMeasurement(structure, workloadName, keyCount, "assign", bulkLoad, loadedHeight);
+
+			// Split the tree at a key and put the two halves back together.
+			Measurement splitting;
+			int splitCount = std::min(static_cast<int>(lookups.size()), MAX_SPLITS);
+			for (int round = 0; round < rounds; ++round)
+			{
+				Tree pieces(tree);
+				timeAction(splitting, splitCount, [&]()
+				{
+					for (int i = 0; i < splitCount; ++i)
+					{
+						auto upperPiece = pieces.split(lookups[i]);
+						pieces.concat(upperPiece);
+					} // end for
+				});
+			} // end for
+			printMeasurement(structure, workloadName, keyCount, "split-concat", splitting, height);
+
+			// Merge in a tree of a hundredth of the keys, as a worker's batch
+			// would be; the time is per key of the smaller tree.
+			Measurement merging;
+			int mergedCount = keyCount / MERGE_DIVISOR + 1;
+			std::vector<int> mergedKeys(lookups.begin(), lookups.begin()
+				+ std::min(mergedCount, static_cast<int>(lookups.size())));
+			for (int round = 0; round < rounds; ++round)
+			{
+				Tree target(tree);
+				Tree batch(mergedKeys.begin(), mergedKeys.end());
+				timeAction(merging, static_cast<long long>(mergedKeys.size()), [&]()
+				{
+					target.unionWith(batch);
+				});
+			} // end for
+			printMeasurement(structure, workloadName, keyCount, "union-1%", merging, height);
+
+			// Save the tree to a file and load it back, timed per entry.
+			std::string fileName = (std::filesystem::temp_directory_path() / "bst_benchmark.tree").string();
+			Measurement saving;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(saving, keyCount, [&]()
+				{
+					tree.save(fileName);
+				});
+			} // end for
+			printMeasurement(structure, workloadName, keyCount, "save", saving, height);
+
+			Measurement loading;
+			for (int round = 0; round < rounds; ++round)
+			{
+				Tree loaded;
+				timeAction(loading, keyCount, [&]()
+				{
+					loaded.load(fileName);
+				});
+				loadedHeight = loaded.getHeight();
+			} // end for
+			printMeasurement(structure, workloadName, keyCount, "load", loading, loadedHeight);
+			std::remove(fileName.c_str());
+		} // end if-else
+	} // end runWorkload
+
+	/**
+	Benchmarks lookups whose popularity follows a Zipf distribution of
+	each exponent in LOOKUP_SKEWS, on a tree built from distinct keys in
+	random order. Rounds follow each other on the same tree, so a tree
+	that adapts to the lookups is measured once it has adapted. The height
+	is that of the tree after the lookups.
+	@param		const std::string& structure
+	@param		const BenchmarkOptions& options
+	@return		void
+	*/
+	template<class Tree>
+	void runSkewedLookups(const std::string& structure, const BenchmarkOptions& options)
+	{
+		if (structure.find(options.filter) == std::string::npos)
+			return; // end if-else
+
+		for (int keyCount : getKeyCounts(options))
+		{
+			std::vector<int> keys = makeKeys(Workload::Random, keyCount, 1);
+			Tree tree;
+			for (int key : keys)
+				tree.add(key); // end for
+
+			for (double skew : LOOKUP_SKEWS)
+			{
+				std::string workloadName = "zipf-" + std::to_string(skew).substr(0, 4);
+				std::vector<int> lookups = makeSkewedLookups(keys, std::min(keyCount, options.maxLookups), skew, 4);
+
+				Measurement lookup;
+				long long hits = 0;
+				for (int round = 0; round < getRounds(keyCount); ++round)
+				{
+					timeAction(lookup, static_cast<long long>(lookups.size()), [&]()
+					{
+						for (int key : lookups)
+							hits += tree.contains(key) ? 1 : 0; // end for
+					});
+				} // end for
+				doNotOptimize(hits);
+				printMeasurement(structure, workloadName.c_str(), keyCount, "contains", lookup, tree.getHeight());
+			} // end for
+		} // end for
+	} // end runSkewedLookups
+
+	/**
+	Benchmarks inorder traversals of a tree of WideEntry objects built from
+	random keys, once with a visitor that takes each entry by reference and
+	once through the function-pointer overload of BinaryTreeInterface,
+	which copies each entry before calling the function. Trees larger than
+	WIDE_KEY_LIMIT entries are skipped to bound the memory used.
+	@param		const std::string& structure
+	@param		const BenchmarkOptions& options
+	@return		void
+	*/
+	template<class Tree>
+	void runWideTraversals(const std::string& structure, const BenchmarkOptions& options)
+	{
+		if (structure.find(options.filter) == std::string::npos)
+			return; // end if-else
+
+		std::string workloadName = "wide-" + std::to_string(sizeof(WideEntry));
+		for (int keyCount : getKeyCounts(options))
+		{
+			if (keyCount > WIDE_KEY_LIMIT)
+			{
+				printSkipped(structure, workloadName.c_str(), keyCount, "too much memory for wide entries");
+				continue;
+			} // end if-else
+
+			std::vector<WideEntry> entries(keyCount);
+			std::vector<int> keys = makeKeys(Workload::Random, keyCount, 1);
+			for (int i = 0; i < keyCount; ++i)
+				entries[i].key = keys[i]; // end for
+
+			Tree tree(entries.begin(), entries.end());
+			int height = tree.getHeight();
+			int rounds = getRounds(keyCount);
+
+			Measurement visitorTraversal;
+			long long sum = 0;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(visitorTraversal, keyCount, [&]()
+				{
+					tree.inorderTraverse([&sum](const WideEntry& anEntry) { sum += anEntry.key; });
+				});
+			} // end for
+			doNotOptimize(sum);
+			printMeasurement(structure, workloadName.c_str(), keyCount, "inorder", visitorTraversal, height);
+
+			Measurement pointerTraversal;
+			for (int round = 0; round < rounds; ++round)
+			{
+				timeAction(pointerTraversal, keyCount, [&]()
+				{
+					tree.inorderTraverse(addWideToVisitedSum);
+				});
+			} // end for
+			doNotOptimize(visitedSum);
+			printMeasurement(structure, workloadName.c_str(), keyCount, "inorder-fn", pointerTraversal, height);
+		} // end for
+	} // end runWideTraversals
+
+	/**
+	Benchmarks one tree type on every workload and size.
+	@param		const std::string& structure
+	@param		bool isBalanced
+	@param		const BenchmarkOptions& options
+	@return		void
+	*/
+	template<class Tree>
+	void runStructure(const std::string& structure, bool isBalanced, const BenchmarkOptions& options)
+	{
+		if (structure.find(options.filter) == std::string::npos)
+			return; // end if-else
+
+		for (Workload workload : getAllWorkloads())
+		{
+			for (int keyCount : getKeyCounts(options))
+			{
+				bool isDegenerate = !isBalanced && isDegenerateWorkload(workload);
+
+				// A degenerate tree is measured once, and only while that stays fast.
+				if (isDegenerate && keyCount > DEGENERATE_KEY_LIMIT)
+					printSkipped(structure, getWorkloadName(workload), keyCount, "quadratic on this workload");
+				else
+					runWorkload<Tree>(structure, workload, keyCount, isDegenerate ? 1 : getRounds(keyCount),
+						options); // end if-else
+			} // end for
+		} // end for
+	} // end runStructure
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+	BenchmarkOptions options = parseOptions(argc, argv);
+
+	printHeader();
+	runStructure<BinarySearchTree<int>>("BinarySearchTree", false, options);
+	runStructure<AVLTree<int>>("AVLTree", true, options);
+	runStructure<MultisetSearchTree<int>>("MultisetSearchTree", true, options);
+	runStructure<SplayTree<int>>("SplayTree", true, options);
+	runStructure<BTree<int>>("BTree", true, options);
+	runStructure<PersistentSearchTree<int>>("PersistentSearchTree", true, options);
+
+	runSkewedLookups<BinarySearchTree<int>>("BinarySearchTree", options);
+	runSkewedLookups<AVLTree<int>>("AVLTree", options);
+	runSkewedLookups<SplayTree<int>>("SplayTree", options);
+
+	runWideTraversals<AVLTree<WideEntry>>("AVLTree", options);
+
+	return 0;
+} // end main
@@ -0,0 +1,321 @@
+/**
+This templated class provides methods for creating and performing
+operations on a self-balancing AVL tree. It is a binary search tree
+that rotates its nodes during additions and removals so that the
+heights of the two subtrees of any node never differ by more than one,
+which keeps the height of the tree logarithmic in its number of nodes
+regardless of the order in which the entries arrive.
+
+@author		Solomon Colley
+@file		AVLTree.cpp
+@since		10/18/2026
+*/
+
+#include "AVLTree.h"
+
+// ---------------------------------------------------------------------------
+// Protected Balancing Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+int AVLTree<ItemType, Compare>::balanceFactor(BinaryNode<ItemType>* nodePtr) const
+{
+	return this->getHeightHelper(nodePtr->getLeftChildPtr())
+		- this->getHeightHelper(nodePtr->getRightChildPtr());
+} // end balanceFactor
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::rotateLeft(BinaryNode<ItemType>* nodePtr)
+{
+	BinaryNode<ItemType>* pivotPtr = nodePtr->getRightChildPtr();
+	nodePtr->setRightChildPtr(pivotPtr->getLeftChildPtr());
+	pivotPtr->setLeftChildPtr(nodePtr);
+	nodePtr->updateHeightAndSize();
+	pivotPtr->updateHeightAndSize();
+	this->getCounters().countRotation();
+	return pivotPtr;
+} // end rotateLeft
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::rotateRight(BinaryNode<ItemType>* nodePtr)
+{
+	BinaryNode<ItemType>* pivotPtr = nodePtr->getLeftChildPtr();
+	nodePtr->setLeftChildPtr(pivotPtr->getRightChildPtr());
+	pivotPtr->setRightChildPtr(nodePtr);
+	nodePtr->updateHeightAndSize();
+	pivotPtr->updateHeightAndSize();
+	this->getCounters().countRotation();
+	return pivotPtr;
+} // end rotateRight
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::rebalance(BinaryNode<ItemType>* nodePtr)
+{
+	if (nodePtr == nullptr)
+		return nullptr; // end if-else
+
+	nodePtr->updateHeightAndSize();
+	int balance = balanceFactor(nodePtr);
+
+	if (balance > 1)	// The left subtree is too tall.
+	{
+		if (balanceFactor(nodePtr->getLeftChildPtr()) < 0)	// Left-right case.
+			nodePtr->setLeftChildPtr(rotateLeft(nodePtr->getLeftChildPtr())); // end if-else
+		return rotateRight(nodePtr);
+	}
+	else if (balance < -1)	// The right subtree is too tall.
+	{
+		if (balanceFactor(nodePtr->getRightChildPtr()) > 0)	// Right-left case.
+			nodePtr->setRightChildPtr(rotateRight(nodePtr->getRightChildPtr())); // end if-else
+		return rotateLeft(nodePtr);
+	}
+	else
+		return nodePtr; // end if-else
+} // end rebalance
+
+// ---------------------------------------------------------------------------
+// Protected BinarySearchTree Overrides Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::insertInorder(BinaryNode<ItemType>* subTreePtr,
+	BinaryNode<ItemType>* newNodePtr)
+{
+	if (subTreePtr == nullptr)
+		return newNodePtr;
+	else
+	{
+		this->getCounters().countVisit();
+		if (this->lessThan(newNodePtr->getItem(), subTreePtr->getItem()))
+			subTreePtr->setLeftChildPtr(insertInorder(subTreePtr->getLeftChildPtr(), newNodePtr));
+		else
+			subTreePtr->setRightChildPtr(insertInorder(subTreePtr->getRightChildPtr(), newNodePtr)); // end if-else
+
+		return rebalance(subTreePtr);
+	} // end if-else
+} // end insertInorder
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::removeValue(BinaryNode<ItemType>* subTreePtr,
+	const ItemType& target,
+	bool& success)
+{
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	std::size_t targetIndex = 0;
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+	BinaryNode<ItemType>* targetPtr = nullptr;
+
+	// Search for the first node that is not less than the target with one
+	// comparison per level, remembering the path down to it.
+	while (currentPtr != nullptr)
+	{
+		this->getCounters().countVisit();
+		if (this->lessThan(currentPtr->getItem(), target))
+		{
+			path.push_back(currentPtr);
+			currentPtr = currentPtr->getRightChildPtr();
+		}
+		else
+		{
+			targetPtr = currentPtr;
+			targetIndex = path.size();
+			path.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end if-else
+	} // end while
+
+	if (targetPtr == nullptr || this->lessThan(target, targetPtr->getItem())) // The item was not found.
+	{
+		path.resize(firstIndex);
+		success = false;
+		return subTreePtr;
+	} // end if-else
+
+	// Remove the target node, then rebalance each of its ancestors in turn,
+	// linking the root of every rebalanced subtree back into its parent.
+	path.resize(targetIndex);
+	success = true;
+	bool isLeftChild = path.size() > firstIndex && path.back()->getLeftChildPtr() == targetPtr;
+	BinaryNode<ItemType>* revisedPtr = rebalance(this->removeNode(targetPtr));
+
+	while (path.size() > firstIndex)
+	{
+		BinaryNode<ItemType>* parentPtr = path.back();
+		path.pop_back();
+
+		if (isLeftChild)
+			parentPtr->setLeftChildPtr(revisedPtr);
+		else
+			parentPtr->setRightChildPtr(revisedPtr); // end if-else
+
+		isLeftChild = path.size() > firstIndex && path.back()->getLeftChildPtr() == parentPtr;
+		revisedPtr = rebalance(parentPtr);
+	} // end while
+
+	return revisedPtr;
+} // end removeValue
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
+	BinaryNode<ItemType>*& successorPtr)
+{
+	if (nodePtr->getLeftChildPtr() == nullptr)
+	{
+		successorPtr = nodePtr;
+		return nodePtr->getRightChildPtr();
+	}
+	else
+	{
+		nodePtr->setLeftChildPtr(removeLeftmostNode(nodePtr->getLeftChildPtr(), successorPtr));
+		return rebalance(nodePtr);
+	} // end if-else
+} // end removeLeftmostNode
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* AVLTree<ItemType, Compare>::joinNodes(BinaryNode<ItemType>* leftPtr,
+	BinaryNode<ItemType>* middlePtr,
+	BinaryNode<ItemType>* rightPtr)
+{
+	int leftHeight = this->getHeightHelper(leftPtr);
+	int rightHeight = this->getHeightHelper(rightPtr);
+	bool isLeftTaller = leftHeight > rightHeight + 1;
+	bool isRightTaller = rightHeight > leftHeight + 1;
+
+	if (!isLeftTaller && !isRightTaller)
+		return BinarySearchTree<ItemType, Compare>::joinNodes(leftPtr, middlePtr, rightPtr); // end if-else
+
+	// Descend the inner spine of the taller subtree to the first subtree that
+	// is at most one level taller than the shorter one. Joining there grows
+	// that subtree by one level, as an insertion would.
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	int shorterHeight = isLeftTaller ? rightHeight : leftHeight;
+	BinaryNode<ItemType>* currentPtr = isLeftTaller ? leftPtr : rightPtr;
+
+	while (this->getHeightHelper(currentPtr) > shorterHeight + 1)
+	{
+		path.push_back(currentPtr);
+		currentPtr = isLeftTaller ? currentPtr->getRightChildPtr() : currentPtr->getLeftChildPtr();
+	} // end while
+
+	BinaryNode<ItemType>* revisedPtr = isLeftTaller
+		? BinarySearchTree<ItemType, Compare>::joinNodes(currentPtr, middlePtr, rightPtr)
+		: BinarySearchTree<ItemType, Compare>::joinNodes(leftPtr, middlePtr, currentPtr);
+
+	while (path.size() > firstIndex)
+	{
+		BinaryNode<ItemType>* parentPtr = path.back();
+		path.pop_back();
+
+		if (isLeftTaller)
+			parentPtr->setRightChildPtr(revisedPtr);
+		else
+			parentPtr->setLeftChildPtr(revisedPtr); // end if-else
+		revisedPtr = rebalance(parentPtr);
+	} // end while
+
+	return revisedPtr;
+} // end joinNodes
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::AVLTree() : BinarySearchTree<ItemType, Compare>()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::AVLTree(const Compare& treeComparator)
+	: BinarySearchTree<ItemType, Compare>(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::AVLTree(const ItemType& rootItem) : BinarySearchTree<ItemType, Compare>(rootItem)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+AVLTree<ItemType, Compare>::AVLTree(InputIterator first, InputIterator last,
+	const Compare& treeComparator) : BinarySearchTree<ItemType, Compare>(first, last, treeComparator)
+{
+} // end range constructor
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::AVLTree(const AVLTree<ItemType, Compare>& tree) : BinarySearchTree<ItemType, Compare>(tree)
+{
+} // end copy constructor
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::AVLTree(AVLTree<ItemType, Compare>&& tree) : BinarySearchTree<ItemType, Compare>(std::move(tree))
+{
+} // end move constructor
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>::~AVLTree()
+{
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Split and Join Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare> AVLTree<ItemType, Compare>::split(const ItemType& aKey)
+{
+	AVLTree<ItemType, Compare> upperTree(this->getComparator());
+	this->splitInto(aKey, upperTree);
+	return upperTree;
+} // end split
+
+template<class ItemType, class Compare>
+void AVLTree<ItemType, Compare>::join(const ItemType& aKey, AVLTree<ItemType, Compare>& greaterTree)
+{
+	BinarySearchTree<ItemType, Compare>::join(aKey, greaterTree);
+} // end join
+
+template<class ItemType, class Compare>
+void AVLTree<ItemType, Compare>::concat(AVLTree<ItemType, Compare>& greaterTree)
+{
+	BinarySearchTree<ItemType, Compare>::concat(greaterTree);
+} // end concat
+
+template<class ItemType, class Compare>
+void AVLTree<ItemType, Compare>::unionWith(AVLTree<ItemType, Compare>& otherTree)
+{
+	BinarySearchTree<ItemType, Compare>::unionWith(otherTree);
+} // end unionWith
+
+template<class ItemType, class Compare>
+void AVLTree<ItemType, Compare>::intersectWith(AVLTree<ItemType, Compare>& otherTree)
+{
+	BinarySearchTree<ItemType, Compare>::intersectWith(otherTree);
+} // end intersectWith
+
+template<class ItemType, class Compare>
+void AVLTree<ItemType, Compare>::differenceWith(AVLTree<ItemType, Compare>& otherTree)
+{
+	BinarySearchTree<ItemType, Compare>::differenceWith(otherTree);
+} // end differenceWith
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>& AVLTree<ItemType, Compare>::operator=(const AVLTree<ItemType, Compare>& rightHandSide)
+{
+	BinarySearchTree<ItemType, Compare>::operator=(rightHandSide);
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+AVLTree<ItemType, Compare>& AVLTree<ItemType, Compare>::operator=(AVLTree<ItemType, Compare>&& rightHandSide)
+{
+	BinarySearchTree<ItemType, Compare>::operator=(std::move(rightHandSide));
+	return *this;
+} // end operator=
@@ -0,0 +1,148 @@
+/**
+This templated class provides methods for creating and performing
+operations on a self-balancing AVL tree. It is a binary search tree
+that rotates its nodes during additions and removals so that the
+heights of the two subtrees of any node never differ by more than one,
+which keeps the height of the tree logarithmic in its number of nodes
+regardless of the order in which the entries arrive.
+
+@author		Solomon Colley
+@file		AVLTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "BinaryNode.h"
+#include "BinarySearchTree.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class AVLTree : public BinarySearchTree<ItemType, Compare>
+{
+protected:
+	// ---------------------------------------------------------------------------
+	// Protected Balancing Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns the balance factor of the given node, which is the height of
+	its left subtree minus the height of its right subtree.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		The balance factor of the node.
+	*/
+	int balanceFactor(BinaryNode<ItemType>* nodePtr) const;
+
+	/**
+	Rotates the subtree rooted at nodePtr to the left so that its right
+	child becomes the new root of the subtree.
+	@pre		nodePtr has a right child.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		A pointer to the new root of the subtree.
+	*/
+	BinaryNode<ItemType>* rotateLeft(BinaryNode<ItemType>* nodePtr);
+
+	/**
+	Rotates the subtree rooted at nodePtr to the right so that its left
+	child becomes the new root of the subtree.
+	@pre		nodePtr has a left child.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		A pointer to the new root of the subtree.
+	*/
+	BinaryNode<ItemType>* rotateRight(BinaryNode<ItemType>* nodePtr);
+
+	/**
+	Restores the AVL property at the given node after one of its subtrees
+	grew or shrank by at least one level, performing a single or double
+	rotation when necessary.
+	@pre		Both subtrees of nodePtr are AVL trees whose heights
+					differ by at most two.
+	@post		The subtree is an AVL tree and its stored height and
+					size are correct.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		A pointer to the root of the rebalanced subtree, or nullptr
+					if nodePtr was nullptr.
+	*/
+	BinaryNode<ItemType>* rebalance(BinaryNode<ItemType>* nodePtr);
+
+	// ---------------------------------------------------------------------------
+	// Protected BinarySearchTree Overrides Section.
+	// See @file BinarySearchTree.h for documentation. Each override rebalances
+	// every node on the path back up to the root of the modified subtree.
+	// ---------------------------------------------------------------------------
+
+	BinaryNode<ItemType>* insertInorder(BinaryNode<ItemType>* subTreePtr,
+		BinaryNode<ItemType>* newNodePtr);
+	BinaryNode<ItemType>* removeValue(BinaryNode<ItemType>* subTreePtr,
+		const ItemType& target,
+		bool& success);
+	BinaryNode<ItemType>* removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
+		BinaryNode<ItemType>*& successorPtr);
+
+	/**
+	Joins two AVL subtrees and a node that goes between them. When their
+	heights differ by more than one, the node is joined with the subtree
+	hanging off the inner spine of the taller subtree that is at most one
+	level taller than the shorter one, and the spine is rebalanced on the
+	way back up, so a join takes O(difference in height) time.
+	@pre		See BinarySearchTree::joinNodes. Both subtrees are AVL
+					trees.
+	@post		The joined subtree is an AVL tree.
+	@param		BinaryNode<ItemType>* leftPtr
+	@param		BinaryNode<ItemType>* middlePtr
+	@param		BinaryNode<ItemType>* rightPtr
+	@return		A pointer to the root of the joined subtree.
+	*/
+	BinaryNode<ItemType>* joinNodes(BinaryNode<ItemType>* leftPtr,
+		BinaryNode<ItemType>* middlePtr,
+		BinaryNode<ItemType>* rightPtr);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	AVLTree();
+	explicit AVLTree(const Compare& treeComparator);
+	AVLTree(const ItemType& rootItem);
+
+	/**
+	Constructs an AVL tree holding the entries in the range [first, last),
+	which need not be sorted. A perfectly balanced tree is built, which
+	satisfies the AVL property. See BinarySearchTree::assign.
+	@param		InputIterator first
+	@param		InputIterator last
+	@param		const Compare& treeComparator
+	*/
+	template<class InputIterator>
+	AVLTree(InputIterator first, InputIterator last, const Compare& treeComparator = Compare());
+	AVLTree(const AVLTree<ItemType, Compare>& tree);
+	AVLTree(AVLTree<ItemType, Compare>&& tree);
+	virtual ~AVLTree();
+
+	// ---------------------------------------------------------------------------
+	// Public Split and Join Section.
+	// See @file BinarySearchTree.h for documentation. These versions only
+	// accept AVL trees, so that the result stays balanced, and take
+	// O(log n) time per split or join.
+	// ---------------------------------------------------------------------------
+
+	AVLTree<ItemType, Compare> split(const ItemType& aKey);
+	void join(const ItemType& aKey, AVLTree<ItemType, Compare>& greaterTree);
+	void concat(AVLTree<ItemType, Compare>& greaterTree);
+	void unionWith(AVLTree<ItemType, Compare>& otherTree);
+	void intersectWith(AVLTree<ItemType, Compare>& otherTree);
+	void differenceWith(AVLTree<ItemType, Compare>& otherTree);
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// See @file BinarySearchTree.h for documentation.
+	// ---------------------------------------------------------------------------
+
+	AVLTree<ItemType, Compare>& operator=(const AVLTree<ItemType, Compare>& rightHandSide);
+	AVLTree<ItemType, Compare>& operator=(AVLTree<ItemType, Compare>&& rightHandSide);
+}; // end AVLTree
+
+#include "AVLTree.cpp"
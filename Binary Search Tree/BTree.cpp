@@ -0,0 +1,710 @@
+/**
+This templated class provides a B-tree that implements the binary tree
+interface, so that it can be used in place of a binary search tree. Each
+node holds up to MAX_KEYS sorted entries in an array sized to fill about
+two cache lines, so a lookup takes roughly log(n) / log(MAX_KEYS) cache
+misses instead of log2(n). Keys within a node are found by a linear,
+branch-free count that the compiler vectorizes for arithmetic types, or
+by a binary search for any other type.
+
+@author		Solomon Colley
+@file		BTree.cpp
+@since		10/18/2026
+*/
+
+#include "BTree.h"
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class LeftType, class RightType>
+bool BTree<ItemType, Compare>::lessThan(const LeftType& left, const RightType& right) const
+{
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+template<class Key>
+int BTree<ItemType, Compare>::findPosition(const LeafNode* nodePtr, const Key& aKey, bool isStrict) const
+{
+	const ItemType* keys = nodePtr->keys;
+	int keyCount = nodePtr->keyCount;
+
+	if constexpr (std::is_arithmetic<ItemType>::value)
+	{
+		// Count the entries ordered before aKey. The loop has no early exit,
+		// so it compiles to a few vector comparisons instead of a branch per
+		// entry.
+		int position = 0;
+		for (int i = 0; i < keyCount; ++i)
+			position += (isStrict ? !lessThan(aKey, keys[i]) : lessThan(keys[i], aKey)) ? 1 : 0; // end for
+		return position;
+	}
+	else
+	{
+		// Comparisons are too costly to make against every entry.
+		if (isStrict)
+			return static_cast<int>(std::upper_bound(keys, keys + keyCount, aKey, comparator) - keys);
+		else
+			return static_cast<int>(std::lower_bound(keys, keys + keyCount, aKey, comparator) - keys); // end if-else
+	} // end if-else
+} // end findPosition
+
+template<class ItemType, class Compare>
+template<class Key>
+const ItemType* BTree<ItemType, Compare>::findEntry(const Key& aKey) const
+{
+	const ItemType* candidatePtr = nullptr;	// Last equivalent entry found on the way down.
+	const LeafNode* nodePtr = rootPtr;
+
+	for (int level = height; level > 0; --level)
+	{
+		int position = findPosition(nodePtr, aKey, false);
+
+		// An earlier equivalent entry can only be in the subtree to the left.
+		if (position < nodePtr->keyCount && !lessThan(aKey, nodePtr->keys[position]))
+			candidatePtr = &nodePtr->keys[position]; // end if-else
+
+		if (level > 1)
+			nodePtr = static_cast<const InternalNode*>(nodePtr)->children[position]; // end if-else
+	} // end for
+
+	return candidatePtr;
+} // end findEntry
+
+template<class ItemType, class Compare>
+template<class Item>
+void BTree<ItemType, Compare>::insert(Item&& newEntry)
+{
+	if (rootPtr == nullptr)
+	{
+		rootPtr = new LeafNode();
+		height = 1;
+	}
+	else if (rootPtr->keyCount == MAX_KEYS)
+	{
+		// Split the full root under a new root, which grows the tree by a level.
+		InternalNode* newRootPtr = new InternalNode();
+		newRootPtr->children[0] = rootPtr;
+		try
+		{
+			splitChild(newRootPtr, 0, height == 1);
+		}
+		catch (...)
+		{
+			delete newRootPtr;
+			throw;
+		} // end try-catch
+		rootPtr = newRootPtr;
+		++height;
+	} // end if-else
+
+	LeafNode* nodePtr = rootPtr;
+	for (int level = height; level > 1; --level)
+	{
+		InternalNode* parentPtr = static_cast<InternalNode*>(nodePtr);
+		int position = findPosition(parentPtr, newEntry, true);
+
+		if (parentPtr->children[position]->keyCount == MAX_KEYS)
+		{
+			splitChild(parentPtr, position, level == 2);
+			if (!lessThan(newEntry, parentPtr->keys[position]))
+				++position; // end if-else
+		} // end if-else
+
+		nodePtr = parentPtr->children[position];
+	} // end for
+
+	int position = findPosition(nodePtr, newEntry, true);
+	std::move_backward(nodePtr->keys + position, nodePtr->keys + nodePtr->keyCount,
+		nodePtr->keys + nodePtr->keyCount + 1);
+	nodePtr->keys[position] = std::forward<Item>(newEntry);
+	++nodePtr->keyCount;
+	++entryCount;
+} // end insert
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::splitChild(InternalNode* parentPtr, int index, bool isLeafChild)
+{
+	LeafNode* fullPtr = parentPtr->children[index];
+	LeafNode* siblingPtr = isLeafChild ? new LeafNode() : new InternalNode();
+
+	// The entries after the middle one move to the new sibling.
+	std::move(fullPtr->keys + MIN_KEYS + 1, fullPtr->keys + MAX_KEYS, siblingPtr->keys);
+	if (!isLeafChild)
+	{
+		InternalNode* fullInternalPtr = static_cast<InternalNode*>(fullPtr);
+		std::copy(fullInternalPtr->children + MIN_KEYS + 1, fullInternalPtr->children + MAX_KEYS + 1,
+			static_cast<InternalNode*>(siblingPtr)->children);
+	} // end if-else
+	fullPtr->keyCount = MIN_KEYS;
+	siblingPtr->keyCount = MIN_KEYS;
+
+	// The middle entry moves up between the two halves.
+	int parentCount = parentPtr->keyCount;
+	std::move_backward(parentPtr->keys + index, parentPtr->keys + parentCount,
+		parentPtr->keys + parentCount + 1);
+	std::copy_backward(parentPtr->children + index + 1, parentPtr->children + parentCount + 1,
+		parentPtr->children + parentCount + 2);
+	parentPtr->keys[index] = std::move(fullPtr->keys[MIN_KEYS]);
+	parentPtr->children[index + 1] = siblingPtr;
+	++parentPtr->keyCount;
+} // end splitChild
+
+template<class ItemType, class Compare>
+int BTree<ItemType, Compare>::fillChild(InternalNode* parentPtr, int index, bool isLeafChild)
+{
+	if (parentPtr->children[index]->keyCount > MIN_KEYS)
+		return index; // end if-else
+
+	if (index > 0 && parentPtr->children[index - 1]->keyCount > MIN_KEYS)
+		rotateRight(parentPtr, index - 1, isLeafChild);
+	else if (index < parentPtr->keyCount && parentPtr->children[index + 1]->keyCount > MIN_KEYS)
+		rotateLeft(parentPtr, index, isLeafChild);
+	else if (index < parentPtr->keyCount)
+		mergeChildren(parentPtr, index, isLeafChild);
+	else
+	{
+		mergeChildren(parentPtr, index - 1, isLeafChild);
+		--index;
+	} // end if-else
+
+	return index;
+} // end fillChild
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::rotateRight(InternalNode* parentPtr, int index, bool isLeafChild)
+{
+	LeafNode* leftPtr = parentPtr->children[index];
+	LeafNode* rightPtr = parentPtr->children[index + 1];
+
+	std::move_backward(rightPtr->keys, rightPtr->keys + rightPtr->keyCount,
+		rightPtr->keys + rightPtr->keyCount + 1);
+	rightPtr->keys[0] = std::move(parentPtr->keys[index]);
+	parentPtr->keys[index] = std::move(leftPtr->keys[leftPtr->keyCount - 1]);
+
+	if (!isLeafChild)
+	{
+		InternalNode* leftInternalPtr = static_cast<InternalNode*>(leftPtr);
+		InternalNode* rightInternalPtr = static_cast<InternalNode*>(rightPtr);
+		std::copy_backward(rightInternalPtr->children, rightInternalPtr->children + rightPtr->keyCount + 1,
+			rightInternalPtr->children + rightPtr->keyCount + 2);
+		rightInternalPtr->children[0] = leftInternalPtr->children[leftPtr->keyCount];
+	} // end if-else
+
+	--leftPtr->keyCount;
+	++rightPtr->keyCount;
+} // end rotateRight
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::rotateLeft(InternalNode* parentPtr, int index, bool isLeafChild)
+{
+	LeafNode* leftPtr = parentPtr->children[index];
+	LeafNode* rightPtr = parentPtr->children[index + 1];
+
+	leftPtr->keys[leftPtr->keyCount] = std::move(parentPtr->keys[index]);
+	parentPtr->keys[index] = std::move(rightPtr->keys[0]);
+	std::move(rightPtr->keys + 1, rightPtr->keys + rightPtr->keyCount, rightPtr->keys);
+
+	if (!isLeafChild)
+	{
+		InternalNode* leftInternalPtr = static_cast<InternalNode*>(leftPtr);
+		InternalNode* rightInternalPtr = static_cast<InternalNode*>(rightPtr);
+		leftInternalPtr->children[leftPtr->keyCount + 1] = rightInternalPtr->children[0];
+		std::copy(rightInternalPtr->children + 1, rightInternalPtr->children + rightPtr->keyCount + 1,
+			rightInternalPtr->children);
+	} // end if-else
+
+	++leftPtr->keyCount;
+	--rightPtr->keyCount;
+} // end rotateLeft
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::mergeChildren(InternalNode* parentPtr, int index, bool isLeafChild)
+{
+	LeafNode* leftPtr = parentPtr->children[index];
+	LeafNode* rightPtr = parentPtr->children[index + 1];
+
+	leftPtr->keys[leftPtr->keyCount] = std::move(parentPtr->keys[index]);
+	std::move(rightPtr->keys, rightPtr->keys + rightPtr->keyCount, leftPtr->keys + leftPtr->keyCount + 1);
+	if (!isLeafChild)
+	{
+		InternalNode* rightInternalPtr = static_cast<InternalNode*>(rightPtr);
+		std::copy(rightInternalPtr->children, rightInternalPtr->children + rightPtr->keyCount + 1,
+			static_cast<InternalNode*>(leftPtr)->children + leftPtr->keyCount + 1);
+	} // end if-else
+	leftPtr->keyCount += rightPtr->keyCount + 1;
+
+	// Close the gap left in the parent.
+	int parentCount = parentPtr->keyCount;
+	std::move(parentPtr->keys + index + 1, parentPtr->keys + parentCount, parentPtr->keys + index);
+	std::copy(parentPtr->children + index + 2, parentPtr->children + parentCount + 1,
+		parentPtr->children + index + 1);
+	--parentPtr->keyCount;
+
+	deleteNode(rightPtr, isLeafChild ? 1 : 2);
+} // end mergeChildren
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::removeFrom(LeafNode* nodePtr, int level, const ItemType& target)
+{
+	while (true)
+	{
+		int position = findPosition(nodePtr, target, false);
+		bool isFound = position < nodePtr->keyCount && !lessThan(target, nodePtr->keys[position]);
+
+		if (level == 1)
+		{
+			if (!isFound)
+				return false; // end if-else
+
+			std::move(nodePtr->keys + position + 1, nodePtr->keys + nodePtr->keyCount,
+				nodePtr->keys + position);
+			--nodePtr->keyCount;
+			return true;
+		} // end if-else
+
+		InternalNode* parentPtr = static_cast<InternalNode*>(nodePtr);
+		bool isLeafChild = (level == 2);
+
+		if (isFound)
+		{
+			// Replace the entry with its predecessor or successor when either
+			// child can spare one, or else merge the entry down into the
+			// merged children and continue there.
+			if (parentPtr->children[position]->keyCount > MIN_KEYS)
+			{
+				parentPtr->keys[position] = takeLast(parentPtr->children[position], level - 1);
+				return true;
+			}
+			else if (parentPtr->children[position + 1]->keyCount > MIN_KEYS)
+			{
+				parentPtr->keys[position] = takeFirst(parentPtr->children[position + 1], level - 1);
+				return true;
+			} // end if-else
+
+			mergeChildren(parentPtr, position, isLeafChild);
+		}
+		else
+			position = fillChild(parentPtr, position, isLeafChild); // end if-else
+
+		nodePtr = parentPtr->children[position];
+		--level;
+	} // end while
+} // end removeFrom
+
+template<class ItemType, class Compare>
+ItemType BTree<ItemType, Compare>::takeLast(LeafNode* nodePtr, int level)
+{
+	for (; level > 1; --level)
+	{
+		InternalNode* parentPtr = static_cast<InternalNode*>(nodePtr);
+		nodePtr = parentPtr->children[fillChild(parentPtr, parentPtr->keyCount, level == 2)];
+	} // end for
+
+	--nodePtr->keyCount;
+	return std::move(nodePtr->keys[nodePtr->keyCount]);
+} // end takeLast
+
+template<class ItemType, class Compare>
+ItemType BTree<ItemType, Compare>::takeFirst(LeafNode* nodePtr, int level)
+{
+	for (; level > 1; --level)
+	{
+		InternalNode* parentPtr = static_cast<InternalNode*>(nodePtr);
+		nodePtr = parentPtr->children[fillChild(parentPtr, 0, level == 2)];
+	} // end for
+
+	ItemType first = std::move(nodePtr->keys[0]);
+	std::move(nodePtr->keys + 1, nodePtr->keys + nodePtr->keyCount, nodePtr->keys);
+	--nodePtr->keyCount;
+	return first;
+} // end takeFirst
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::deleteNode(LeafNode* nodePtr, int level)
+{
+	if (level == 1)
+		delete nodePtr;
+	else
+		delete static_cast<InternalNode*>(nodePtr); // end if-else
+} // end deleteNode
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::destroyTree(LeafNode* nodePtr, int level)
+{
+	if (nodePtr == nullptr)
+		return; // end if-else
+
+	if (level > 1)
+	{
+		InternalNode* parentPtr = static_cast<InternalNode*>(nodePtr);
+		for (int i = 0; i <= parentPtr->keyCount; ++i)
+			destroyTree(parentPtr->children[i], level - 1); // end for
+	} // end if-else
+
+	deleteNode(nodePtr, level);
+} // end destroyTree
+
+template<class ItemType, class Compare>
+typename BTree<ItemType, Compare>::LeafNode* BTree<ItemType, Compare>::copyTree(const LeafNode* nodePtr,
+	int level)
+{
+	if (nodePtr == nullptr)
+		return nullptr; // end if-else
+
+	if (level == 1)
+		return new LeafNode(*nodePtr); // end if-else
+
+	const InternalNode* parentPtr = static_cast<const InternalNode*>(nodePtr);
+	InternalNode* copyPtr = new InternalNode();
+	int copiedChildren = 0;
+	try
+	{
+		std::copy(parentPtr->keys, parentPtr->keys + parentPtr->keyCount, copyPtr->keys);
+		for (; copiedChildren <= parentPtr->keyCount; ++copiedChildren)
+			copyPtr->children[copiedChildren] = copyTree(parentPtr->children[copiedChildren], level - 1); // end for
+	}
+	catch (...)
+	{
+		for (int i = 0; i < copiedChildren; ++i)
+			destroyTree(copyPtr->children[i], level - 1); // end for
+		delete copyPtr;
+		throw;
+	} // end try-catch
+	copyPtr->keyCount = parentPtr->keyCount;
+
+	return copyPtr;
+} // end copyTree
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::preorderVisit(Visitor& visit, const LeafNode* nodePtr, int level)
+{
+	if (nodePtr == nullptr)
+		return true; // end if-else
+
+	for (int i = 0; i < nodePtr->keyCount; ++i)
+	{
+		if (!applyVisitor(visit, nodePtr->keys[i]))
+			return false; // end if-else
+	} // end for
+
+	if (level > 1)
+	{
+		const InternalNode* parentPtr = static_cast<const InternalNode*>(nodePtr);
+		for (int i = 0; i <= parentPtr->keyCount; ++i)
+		{
+			if (!preorderVisit(visit, parentPtr->children[i], level - 1))
+				return false; // end if-else
+		} // end for
+	} // end if-else
+
+	return true;
+} // end preorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::inorderVisit(Visitor& visit, const LeafNode* nodePtr, int level)
+{
+	if (nodePtr == nullptr)
+		return true; // end if-else
+
+	if (level == 1)
+	{
+		for (int i = 0; i < nodePtr->keyCount; ++i)
+		{
+			if (!applyVisitor(visit, nodePtr->keys[i]))
+				return false; // end if-else
+		} // end for
+		return true;
+	} // end if-else
+
+	// Each entry of an internal node lies between two of its subtrees.
+	const InternalNode* parentPtr = static_cast<const InternalNode*>(nodePtr);
+	for (int i = 0; i < parentPtr->keyCount; ++i)
+	{
+		if (!inorderVisit(visit, parentPtr->children[i], level - 1)
+			|| !applyVisitor(visit, parentPtr->keys[i]))
+			return false; // end if-else
+	} // end for
+
+	return inorderVisit(visit, parentPtr->children[parentPtr->keyCount], level - 1);
+} // end inorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::postorderVisit(Visitor& visit, const LeafNode* nodePtr, int level)
+{
+	if (nodePtr == nullptr)
+		return true; // end if-else
+
+	if (level > 1)
+	{
+		const InternalNode* parentPtr = static_cast<const InternalNode*>(nodePtr);
+		for (int i = 0; i <= parentPtr->keyCount; ++i)
+		{
+			if (!postorderVisit(visit, parentPtr->children[i], level - 1))
+				return false; // end if-else
+		} // end for
+	} // end if-else
+
+	for (int i = 0; i < nodePtr->keyCount; ++i)
+	{
+		if (!applyVisitor(visit, nodePtr->keys[i]))
+			return false; // end if-else
+	} // end for
+
+	return true;
+} // end postorderVisit
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>::BTree() : rootPtr(nullptr), height(0), entryCount(0), comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>::BTree(const Compare& treeComparator)
+	: rootPtr(nullptr), height(0), entryCount(0), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>::BTree(const BTree<ItemType, Compare>& tree)
+	: rootPtr(nullptr), height(tree.height), entryCount(tree.entryCount), comparator(tree.comparator)
+{
+	rootPtr = copyTree(tree.rootPtr, tree.height);
+} // end copy constructor
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>::BTree(BTree<ItemType, Compare>&& tree)
+	: rootPtr(tree.rootPtr), height(tree.height), entryCount(tree.entryCount),
+	comparator(std::move(tree.comparator))
+{
+	tree.rootPtr = nullptr;
+	tree.height = 0;
+	tree.entryCount = 0;
+} // end move constructor
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>::~BTree()
+{
+	clear();
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public BinaryTreeInterface Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::isEmpty() const
+{
+	return entryCount == 0;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int BTree<ItemType, Compare>::getHeight() const
+{
+	return height;
+} // end getHeight
+
+template<class ItemType, class Compare>
+int BTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return entryCount;
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+const ItemType& BTree<ItemType, Compare>::getRootData() const
+{
+	if (isEmpty())
+		throw PreconditionException("Function getRootData() was called with an empty tree."); // end if-else
+
+	return rootPtr->keys[rootPtr->keyCount / 2];
+} // end getRootData
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::setRootData(const ItemType& /* newData */)
+{
+	throw PreconditionException("The root data in a B-tree cannot be changed.");
+} // end setRootData
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	insert(newEntry);
+	return true;
+} // end add
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::add(ItemType&& newEntry)
+{
+	insert(std::move(newEntry));
+	return true;
+} // end add
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::remove(const ItemType& anEntry)
+{
+	if (rootPtr == nullptr)
+		return false; // end if-else
+
+	bool isRemoved = removeFrom(rootPtr, height, anEntry);
+	if (isRemoved)
+		--entryCount; // end if-else
+
+	// A merge below the root, or the last removal, can leave it empty.
+	if (rootPtr->keyCount == 0)
+	{
+		LeafNode* oldRootPtr = rootPtr;
+		rootPtr = (height > 1) ? static_cast<InternalNode*>(oldRootPtr)->children[0] : nullptr;
+		deleteNode(oldRootPtr, height);
+		--height;
+	} // end if-else
+
+	return isRemoved;
+} // end remove
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::clear()
+{
+	destroyTree(rootPtr, height);
+	rootPtr = nullptr;
+	height = 0;
+	entryCount = 0;
+} // end clear
+
+template<class ItemType, class Compare>
+const ItemType& BTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	const ItemType* entryPtr = findEntry(anEntry);
+
+	if (entryPtr == nullptr)
+		throw NotFoundException("The entry does not exist within the B-tree.");
+	else
+		return *entryPtr; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool BTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	const LeafNode* nodePtr = rootPtr;
+
+	// Unlike getEntry, stop at the first equivalent entry on the way down.
+	for (int level = height; level > 0; --level)
+	{
+		int position = findPosition(nodePtr, anEntry, false);
+		if (position < nodePtr->keyCount && !lessThan(anEntry, nodePtr->keys[position]))
+			return true; // end if-else
+
+		if (level > 1)
+			nodePtr = static_cast<const InternalNode*>(nodePtr)->children[position]; // end if-else
+	} // end for
+
+	return false;
+} // end contains
+
+template<class ItemType, class Compare>
+Compare BTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Traversals Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::preorderTraverse(void visit(ItemType&)) const
+{
+	preorderTraverse([visit](const ItemType& anEntry)
+	{
+		ItemType theItem = anEntry;
+		visit(theItem);
+	});
+} // end preorderTraverse
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::inorderTraverse(void visit(ItemType&)) const
+{
+	inorderTraverse([visit](const ItemType& anEntry)
+	{
+		ItemType theItem = anEntry;
+		visit(theItem);
+	});
+} // end inorderTraverse
+
+template<class ItemType, class Compare>
+void BTree<ItemType, Compare>::postorderTraverse(void visit(ItemType&)) const
+{
+	postorderTraverse([visit](const ItemType& anEntry)
+	{
+		ItemType theItem = anEntry;
+		visit(theItem);
+	});
+} // end postorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::preorderTraverse(Visitor&& visit) const
+{
+	return preorderVisit(visit, rootPtr, height);
+} // end preorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	return inorderVisit(visit, rootPtr, height);
+} // end inorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BTree<ItemType, Compare>::postorderTraverse(Visitor&& visit) const
+{
+	return postorderVisit(visit, rootPtr, height);
+} // end postorderTraverse
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>& BTree<ItemType, Compare>::operator=(const BTree<ItemType, Compare>& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		LeafNode* copyPtr = copyTree(rightHandSide.rootPtr, rightHandSide.height);
+		clear();
+		rootPtr = copyPtr;
+		height = rightHandSide.height;
+		entryCount = rightHandSide.entryCount;
+		comparator = rightHandSide.comparator;
+	} // end if-else
+
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+BTree<ItemType, Compare>& BTree<ItemType, Compare>::operator=(BTree<ItemType, Compare>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		clear();
+		rootPtr = rightHandSide.rootPtr;
+		height = rightHandSide.height;
+		entryCount = rightHandSide.entryCount;
+		comparator = std::move(rightHandSide.comparator);
+		rightHandSide.rootPtr = nullptr;
+		rightHandSide.height = 0;
+		rightHandSide.entryCount = 0;
+	} // end if-else
+
+	return *this;
+} // end operator=
@@ -0,0 +1,315 @@
+/**
+This templated class provides a B-tree that implements the binary tree
+interface, so that it can be used in place of a binary search tree. Each
+node holds up to MAX_KEYS sorted entries in an array sized to fill about
+two cache lines, so a lookup takes roughly log(n) / log(MAX_KEYS) cache
+misses instead of log2(n). Keys within a node are found by a linear,
+branch-free count that the compiler vectorizes for arithmetic types, or
+by a binary search for any other type.
+
+@author		Solomon Colley
+@file		BTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "BinaryTreeInterface.h"
+#include "NotFoundException.h"
+#include "PreconditionException.h"
+#include "TreeVisitor.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class BTree : public BinaryTreeInterface<ItemType>
+{
+public:
+	static const int NODE_BYTES = 128;	// Target size of the entries and count of a node.
+
+	// Entries that fit in NODE_BYTES beside the count.
+	static const int FITTING_KEYS = static_cast<int>(NODE_BYTES / sizeof(ItemType)) - 1;
+
+	// The most entries a node holds. It is odd, so that a full node splits
+	// into two nodes of MIN_KEYS entries around its middle entry.
+	static const int MAX_KEYS = (FITTING_KEYS < 3) ? 3 : FITTING_KEYS - (FITTING_KEYS % 2 == 0 ? 1 : 0);
+
+	// The fewest entries a node other than the root holds.
+	static const int MIN_KEYS = MAX_KEYS / 2;
+
+private:
+	/**
+	A node on the lowest level, which holds entries only.
+	*/
+	struct alignas(64) LeafNode
+	{
+		int keyCount;				// Number of entries in use.
+		ItemType keys[MAX_KEYS];	// Entries in ascending order.
+
+		LeafNode() : keyCount(0) {}
+	}; // end LeafNode
+
+	/**
+	A node above the lowest level. The subtree at children[i] holds the
+	entries ordered between keys[i - 1] and keys[i].
+	*/
+	struct alignas(64) InternalNode : LeafNode
+	{
+		LeafNode* children[MAX_KEYS + 1];	// Subtrees, keyCount + 1 of them in use.
+	}; // end InternalNode
+
+	LeafNode* rootPtr;		// Root node, or nullptr if the tree is empty.
+	int height;				// Number of levels of nodes; the leaves are at level 1.
+	int entryCount;			// Number of entries in the tree.
+	Compare comparator;		// Strict weak ordering of the entries.
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree.
+	@param		const LeftType& left
+	@param		const RightType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	template<class LeftType, class RightType>
+	bool lessThan(const LeftType& left, const RightType& right) const;
+
+	/**
+	Returns the position of the first entry of the given node that is not
+	less than aKey, or greater than aKey when isStrict is true.
+	@param		const LeafNode* nodePtr
+	@param		const Key& aKey
+	@param		bool isStrict
+	@return		A position from 0 to the number of entries in the node.
+	*/
+	template<class Key>
+	int findPosition(const LeafNode* nodePtr, const Key& aKey, bool isStrict) const;
+
+	/**
+	Returns the first entry in inorder that is equivalent to aKey.
+	@param		const Key& aKey
+	@return		A pointer to the entry, or nullptr if there is none.
+	*/
+	template<class Key>
+	const ItemType* findEntry(const Key& aKey) const;
+
+	/**
+	Inserts a new entry after any equivalent entries, splitting every full
+	node on the way down so that the leaf it ends in has room.
+	@post		The tree holds the new entry.
+	@param		Item&& newEntry
+	@return		void
+	*/
+	template<class Item>
+	void insert(Item&& newEntry);
+
+	/**
+	Splits the full child at the given position of parentPtr into two
+	nodes of MIN_KEYS entries and moves its middle entry up into
+	parentPtr.
+	@pre		parentPtr is not full and its child at index is.
+	@param		InternalNode* parentPtr
+	@param		int index
+	@param		bool isLeafChild
+	@return		void
+	*/
+	void splitChild(InternalNode* parentPtr, int index, bool isLeafChild);
+
+	/**
+	Makes sure that the child at the given position of parentPtr holds more
+	than MIN_KEYS entries before a removal descends into it, by borrowing
+	an entry through parentPtr from a sibling or by merging it with one.
+	@pre		parentPtr holds more than MIN_KEYS entries or is the root.
+	@param		InternalNode* parentPtr
+	@param		int index
+	@param		bool isLeafChild
+	@return		The position of the child that now holds the entries of
+					the original child.
+	*/
+	int fillChild(InternalNode* parentPtr, int index, bool isLeafChild);
+
+	/**
+	Moves the last entry of the child at index up into parentPtr and the
+	entry of parentPtr between them down into the front of the next
+	child, or the reverse for rotateLeft.
+	@param		InternalNode* parentPtr
+	@param		int index
+	@param		bool isLeafChild
+	@return		void
+	*/
+	void rotateRight(InternalNode* parentPtr, int index, bool isLeafChild);
+	void rotateLeft(InternalNode* parentPtr, int index, bool isLeafChild);
+
+	/**
+	Merges the children at index and index + 1 of parentPtr, together with
+	the entry of parentPtr between them, into the child at index.
+	@pre		Both children hold MIN_KEYS entries.
+	@param		InternalNode* parentPtr
+	@param		int index
+	@param		bool isLeafChild
+	@return		void
+	*/
+	void mergeChildren(InternalNode* parentPtr, int index, bool isLeafChild);
+
+	/**
+	Removes an entry equivalent to target from the subtree of nodePtr.
+	@pre		nodePtr holds more than MIN_KEYS entries or is the root.
+	@param		LeafNode* nodePtr
+	@param		int level
+	@param		const ItemType& target
+	@return		True if an entry was removed, or false if there was none.
+	*/
+	bool removeFrom(LeafNode* nodePtr, int level, const ItemType& target);
+
+	/**
+	Removes the largest or smallest entry of the subtree of nodePtr.
+	@pre		nodePtr holds more than MIN_KEYS entries.
+	@param		LeafNode* nodePtr
+	@param		int level
+	@return		The removed entry.
+	*/
+	ItemType takeLast(LeafNode* nodePtr, int level);
+	ItemType takeFirst(LeafNode* nodePtr, int level);
+
+	/**
+	Deletes a node on the given level, or every node of its subtree for
+	destroyTree.
+	@param		LeafNode* nodePtr
+	@param		int level
+	@return		void
+	*/
+	static void deleteNode(LeafNode* nodePtr, int level);
+	static void destroyTree(LeafNode* nodePtr, int level);
+
+	/**
+	Returns a deep copy of the subtree of nodePtr on the given level.
+	@param		const LeafNode* nodePtr
+	@param		int level
+	@return		A pointer to the root of the copy.
+	*/
+	static LeafNode* copyTree(const LeafNode* nodePtr, int level);
+
+	/**
+	Traverses the subtree of nodePtr on the given level, stopping as soon
+	as visit returns false. Preorder visits the entries of a node before
+	its subtrees and postorder after them.
+	@param		Visitor& visit
+	@param		const LeafNode* nodePtr
+	@param		int level
+	@return		True if every entry was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	static bool preorderVisit(Visitor& visit, const LeafNode* nodePtr, int level);
+	template<class Visitor>
+	static bool inorderVisit(Visitor& visit, const LeafNode* nodePtr, int level);
+	template<class Visitor>
+	static bool postorderVisit(Visitor& visit, const LeafNode* nodePtr, int level);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	BTree();
+	explicit BTree(const Compare& treeComparator);
+	BTree(const BTree<ItemType, Compare>& tree);
+	BTree(BTree<ItemType, Compare>&& tree);
+	virtual ~BTree();
+
+	// ---------------------------------------------------------------------------
+	// Public BinaryTreeInterface Methods Section.
+	// See @file BinaryTreeInterface.h for documentation. The number of nodes
+	// is the number of entries, as it is for the binary trees, and the height
+	// is the number of levels of B-tree nodes.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+	int getHeight() const;
+	int getNumberOfNodes() const;
+
+	/**
+	Returns the middle entry of the root node, which splits the entries
+	of the tree most evenly.
+	@pre		The tree is not empty.
+	@return		A reference to the entry.
+	@throws		PreconditionException if the tree is empty.
+	*/
+	const ItemType& getRootData() const;
+
+	/**
+	The root data of a search tree cannot be replaced without breaking its
+	order.
+	@throws		PreconditionException always.
+	*/
+	void setRootData(const ItemType& newData);
+
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+
+	/**
+	Removes one entry equivalent to anEntry from this tree.
+	@post		One equivalent entry was removed if there was any.
+	@param		const ItemType& anEntry
+	@return		True if an entry was removed, or false if not.
+	*/
+	bool remove(const ItemType& anEntry);
+
+	void clear();
+	const ItemType& getEntry(const ItemType& anEntry) const;
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries of this tree.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Traversals Section.
+	// The function pointer versions pass a copy of each entry to visit, and
+	// the templated versions pass a constant reference and stop as soon as
+	// visit returns false, as in BinarySearchTree.
+	// ---------------------------------------------------------------------------
+
+	void preorderTraverse(void visit(ItemType&)) const;
+	void inorderTraverse(void visit(ItemType&)) const;
+	void postorderTraverse(void visit(ItemType&)) const;
+
+	template<class Visitor>
+	bool preorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool postorderTraverse(Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Overloads the assignment operator = for clearing the tree and copying
+	the entries of rightHandSide to this tree.
+	@post		rightHandSide is copied and a reference to this tree is returned.
+	@param		const BTree& rightHandSide
+	@return		A reference to this tree.
+	*/
+	BTree<ItemType, Compare>& operator=(const BTree<ItemType, Compare>& rightHandSide);
+
+	/**
+	Overloads the assignment operator = for clearing the tree and taking
+	over the nodes of rightHandSide without copying them.
+	@post		rightHandSide is empty.
+	@param		BTree&& rightHandSide
+	@return		A reference to this tree.
+	*/
+	BTree<ItemType, Compare>& operator=(BTree<ItemType, Compare>&& rightHandSide);
+}; // end BTree
+
+#include "BTree.cpp"
@@ -10,21 +10,51 @@ operations with a binary node.
 #include "BinaryNode.h"
 
 template<class ItemType>
-BinaryNode<ItemType>::BinaryNode() : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr)
+BinaryNode<ItemType>::BinaryNode() : item(nullptr), leftChildPtr(nullptr), rightChildPtr(nullptr),
+	parentPtr(nullptr), height(1), size(1)
 {
 } // end default constructor
 
 template<class ItemType>
-BinaryNode<ItemType>::BinaryNode(const ItemType& anItem) : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr)
+BinaryNode<ItemType>::BinaryNode(const ItemType& anItem) : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr),
+	parentPtr(nullptr), height(1), size(1)
 {
 } // end parameterized constructor
 
 template<class ItemType>
 BinaryNode<ItemType>::BinaryNode(const ItemType& anItem, BinaryNode<ItemType>* leftPtr,
-	BinaryNode<ItemType>* rightPtr) : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr)
+	BinaryNode<ItemType>* rightPtr) : item(anItem), leftChildPtr(nullptr), rightChildPtr(nullptr),
+	parentPtr(nullptr), height(1), size(1)
 {
+	setLeftChildPtr(leftPtr);
+	setRightChildPtr(rightPtr);
+	updateHeightAndSize();
 } // end parameterized constructor
 
+template<class ItemType>
+BinaryNode<ItemType>::BinaryNode(ItemType&& anItem) : item(std::move(anItem)), leftChildPtr(nullptr),
+	rightChildPtr(nullptr), parentPtr(nullptr), height(1), size(1)
+{
+} // end move constructor
+
+template<class ItemType>
+BinaryNode<ItemType>::BinaryNode(ItemType&& anItem, BinaryNode<ItemType>* leftPtr,
+	BinaryNode<ItemType>* rightPtr) : item(std::move(anItem)), leftChildPtr(nullptr), rightChildPtr(nullptr),
+	parentPtr(nullptr), height(1), size(1)
+{
+	setLeftChildPtr(leftPtr);
+	setRightChildPtr(rightPtr);
+	updateHeightAndSize();
+} // end move constructor
+
+template<class ItemType>
+template<class... Args>
+BinaryNode<ItemType>::BinaryNode(std::piecewise_construct_t, Args&&... args)
+	: item(std::forward<Args>(args)...), leftChildPtr(nullptr), rightChildPtr(nullptr),
+	parentPtr(nullptr), height(1), size(1)
+{
+} // end emplacing constructor
+
 template<class ItemType>
 void BinaryNode<ItemType>::setItem(const ItemType& anItem)
 {
@@ -32,7 +62,20 @@ void BinaryNode<ItemType>::setItem(const ItemType& anItem)
 } // end setItem
 
 template<class ItemType>
-ItemType BinaryNode<ItemType>::getItem() const
+void BinaryNode<ItemType>::setItem(ItemType&& anItem)
+{
+	item = std::move(anItem);
+} // end setItem
+
+template<class ItemType>
+void BinaryNode<ItemType>::swapItem(BinaryNode<ItemType>& otherNode)
+{
+	using std::swap;
+	swap(item, otherNode.item);
+} // end swapItem
+
+template<class ItemType>
+const ItemType& BinaryNode<ItemType>::getItem() const
 {
 	return item;
 } // end getItem
@@ -47,12 +90,16 @@ template<class ItemType>
 void BinaryNode<ItemType>::setLeftChildPtr(BinaryNode<ItemType>* leftPtr)
 {
 	leftChildPtr = leftPtr;
+	if (leftPtr != nullptr)
+		leftPtr->parentPtr = this; // end if-else
 } // end setLeftChildPtr
 
 template<class ItemType>
 void BinaryNode<ItemType>::setRightChildPtr(BinaryNode<ItemType>* rightPtr)
 {
 	rightChildPtr = rightPtr;
+	if (rightPtr != nullptr)
+		rightPtr->parentPtr = this; // end if-else
 } // end setRightChildPtr
 
 template<class ItemType>
@@ -65,4 +112,60 @@ template<class ItemType>
 BinaryNode<ItemType>* BinaryNode<ItemType>::getRightChildPtr() const
 {
 	return rightChildPtr;
-} // end getRightChildPtr		
+} // end getRightChildPtr
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNode<ItemType>::getParentPtr() const
+{
+	return parentPtr;
+} // end getParentPtr
+
+template<class ItemType>
+void BinaryNode<ItemType>::setParentPtr(BinaryNode<ItemType>* newParentPtr)
+{
+	parentPtr = newParentPtr;
+} // end setParentPtr
+
+template<class ItemType>
+int BinaryNode<ItemType>::getHeight() const
+{
+	return height;
+} // end getHeight
+
+template<class ItemType>
+void BinaryNode<ItemType>::setHeight(int newHeight)
+{
+	height = newHeight;
+} // end setHeight
+
+template<class ItemType>
+int BinaryNode<ItemType>::getSize() const
+{
+	return size;
+} // end getSize
+
+template<class ItemType>
+void BinaryNode<ItemType>::setSize(int newSize)
+{
+	size = newSize;
+} // end setSize
+
+template<class ItemType>
+void BinaryNode<ItemType>::updateHeightAndSize()
+{
+	int leftHeight = 0, rightHeight = 0;
+	size = 1;
+
+	if (leftChildPtr != nullptr)
+	{
+		leftHeight = leftChildPtr->height;
+		size += leftChildPtr->size;
+	} // end if-else
+	if (rightChildPtr != nullptr)
+	{
+		rightHeight = rightChildPtr->height;
+		size += rightChildPtr->size;
+	} // end if-else
+
+	height = 1 + ((leftHeight > rightHeight) ? leftHeight : rightHeight);
+} // end updateHeightAndSize
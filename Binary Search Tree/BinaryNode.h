@@ -9,6 +9,8 @@ operations with a binary node.
 
 #pragma once
 
+#include <utility>
+
 template<class ItemType>
 class BinaryNode
 {
@@ -16,6 +18,9 @@ private:
 	ItemType item;							// Data item.
 	BinaryNode<ItemType>* leftChildPtr;		// Pointer to the left child.
 	BinaryNode<ItemType>* rightChildPtr;	// Pointer to the right child.
+	BinaryNode<ItemType>* parentPtr;		// Pointer to the parent, or nullptr for a root.
+	int height;								// Height of the subtree rooted here.
+	int size;								// Number of nodes in the subtree rooted here.
 
 public:
 	// -------------------------------------------------------------------------------------
@@ -27,6 +32,20 @@ public:
 	BinaryNode(const ItemType& anItem,
 		BinaryNode<ItemType>* leftPtr,
 		BinaryNode<ItemType>* rightPtr);
+	BinaryNode(ItemType&& anItem);
+	BinaryNode(ItemType&& anItem,
+		BinaryNode<ItemType>* leftPtr,
+		BinaryNode<ItemType>* rightPtr);
+
+	/**
+	Constructs the data item of this node in place from the given
+	constructor arguments. The std::piecewise_construct tag tells this
+	constructor apart from the ones above.
+	@param		std::piecewise_construct_t
+	@param		Args&&... args
+	*/
+	template<class... Args>
+	BinaryNode(std::piecewise_construct_t, Args&&... args);
 
 	// -------------------------------------------------------------------------------------
 	// Public Methods Section.
@@ -39,11 +58,26 @@ public:
 	*/
 	void setItem(const ItemType& anItem);
 
+	/**
+	Moves the argument data item into this node's data item.
+	@param		ItemType&& anItem
+	@return		void
+	*/
+	void setItem(ItemType&& anItem);
+
+	/**
+	Exchanges the data items of this node and otherNode without copying
+	them. The links of both nodes are unchanged.
+	@param		BinaryNode<ItemType>& otherNode
+	@return		void
+	*/
+	void swapItem(BinaryNode<ItemType>& otherNode);
+
 	/**
 	Returns the data item of this node.
-	@return		A data item.
+	@return		A reference to the data item.
 	*/
-	ItemType getItem() const;
+	const ItemType& getItem() const;
 
 	/**
 	Tests whether this node is a leaf or not.
@@ -64,18 +98,76 @@ public:
 	BinaryNode<ItemType>* getRightChildPtr() const;
 
 	/**
-	Sets the argument leftPtr to this node's left child pointer.
+	Returns the parent pointer of this node.
+	@return		The parent pointer of this node, or nullptr if this
+					node is the root of its tree.
+	*/
+	BinaryNode<ItemType>* getParentPtr() const;
+
+	/**
+	Sets the argument leftPtr to this node's left child pointer and makes
+	this node the parent of leftPtr.
 	@param		BinaryNode<ItemType>* leftPtr
 	@return		void
 	*/
 	void setLeftChildPtr(BinaryNode<ItemType>* leftPtr);
 
 	/**
-	Sets the argument rightPtr to this node's right child pointer.
+	Sets the argument rightPtr to this node's right child pointer and makes
+	this node the parent of rightPtr.
 	@param		BinaryNode<ItemType>* rightPtr
 	@return		void
 	*/
 	void setRightChildPtr(BinaryNode<ItemType>* rightPtr);
+
+	/**
+	Sets the argument newParentPtr to this node's parent pointer. The child
+	setters keep parent pointers up to date, so this is only needed when a
+	node becomes the root of a tree.
+	@param		BinaryNode<ItemType>* newParentPtr
+	@return		void
+	*/
+	void setParentPtr(BinaryNode<ItemType>* newParentPtr);
+
+	/**
+	Returns the height of the subtree rooted at this node. A leaf has
+	a height of 1.
+	@return		The stored height of this node's subtree.
+	*/
+	int getHeight() const;
+
+	/**
+	Sets the argument newHeight to the stored height of this node's subtree.
+	@param		int newHeight
+	@return		void
+	*/
+	void setHeight(int newHeight);
+
+	/**
+	Returns the number of nodes in the subtree rooted at this node,
+	including this node.
+	@return		The stored number of nodes in this node's subtree.
+	*/
+	int getSize() const;
+
+	/**
+	Sets the argument newSize to the stored number of nodes in this
+	node's subtree.
+	@param		int newSize
+	@return		void
+	*/
+	void setSize(int newSize);
+
+	/**
+	Recomputes the stored height and number of nodes of this node's
+	subtree from the values stored in its children. Must be called on
+	every node along a path whose children were changed, from the
+	bottom up.
+	@pre		The heights and sizes stored in the children are correct.
+	@post		The height and size stored in this node are correct.
+	@return		void
+	*/
+	void updateHeightAndSize();
 }; // end BinaryNode
 
 #include "BinaryNode.cpp"
@@ -11,90 +11,120 @@ operations with a binary tree.
 
 // -------------------------------------------------------------------------------------
 // Protected Utility Methods Section.
-// Recursive helper methods for the public methods.
+// Iterative helper methods for the public methods. None of them recurse, so
+// their stack usage is bounded regardless of the shape of the tree.
 // -------------------------------------------------------------------------------------
 
 template<class ItemType>
 int BinaryNodeTree<ItemType>::getHeightHelper(BinaryNode<ItemType>* subTreePtr) const
 {
-	if (subTreePtr == nullptr)
-		return 0;
-	else
-		return 1 + std::max(getHeightHelper(subTreePtr->getLeftChildPtr()),
-			getHeightHelper(subTreePtr->getRightChildPtr())); // end if-else
+	return (subTreePtr == nullptr) ? 0 : subTreePtr->getHeight();
 } // end getHeightHelper
 
 template<class ItemType>
 int BinaryNodeTree<ItemType>::getNumberOfNodesHelper(BinaryNode<ItemType>* subTreePtr) const
 {
-	if (subTreePtr == nullptr)
-		return 0;
-	else
-		return 1 + getNumberOfNodesHelper(subTreePtr->getLeftChildPtr())
-		+ getNumberOfNodesHelper(subTreePtr->getRightChildPtr()); // end if-else
+	return (subTreePtr == nullptr) ? 0 : subTreePtr->getSize();
 } // end getNumberOfNodesHelper
 
+template<class ItemType>
+std::vector<BinaryNode<ItemType>*>& BinaryNodeTree<ItemType>::getPathBuffer()
+{
+	return pathBuffer;
+} // end getPathBuffer
+
+template<class ItemType>
+const TreeCounters& BinaryNodeTree<ItemType>::getCounters() const
+{
+	return counters;
+} // end getCounters
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::updatePath(std::size_t firstIndex)
+{
+	while (pathBuffer.size() > firstIndex)
+	{
+		pathBuffer.back()->updateHeightAndSize();
+		pathBuffer.pop_back();
+	} // end while
+} // end updatePath
+
 template<class ItemType>
 BinaryNode<ItemType>* BinaryNodeTree<ItemType>::balancedAdd(BinaryNode<ItemType>* subTreePtr,
 	BinaryNode<ItemType>* newNodePtr)
 {
 	if (subTreePtr == nullptr)
-		return newNodePtr;
-	else
+		return newNodePtr; // end if-else
+
+	std::size_t firstIndex = pathBuffer.size();
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+
+	// Descend into the shorter subtree until an empty position is found.
+	while (currentPtr != nullptr)
 	{
-		BinaryNode<ItemType>* leftPtr = subTreePtr->getLeftChildPtr();
-		BinaryNode<ItemType>* rightPtr = subTreePtr->getRightChildPtr();
+		pathBuffer.push_back(currentPtr);
+		BinaryNode<ItemType>* leftPtr = currentPtr->getLeftChildPtr();
+		BinaryNode<ItemType>* rightPtr = currentPtr->getRightChildPtr();
 
 		if (getHeightHelper(leftPtr) > getHeightHelper(rightPtr))
 		{
-			rightPtr = balancedAdd(rightPtr, newNodePtr);
-			subTreePtr->setRightChildPtr(rightPtr);
+			if (rightPtr == nullptr)
+				currentPtr->setRightChildPtr(newNodePtr); // end if-else
+			currentPtr = rightPtr;
 		}
 		else
 		{
-			leftPtr = balancedAdd(leftPtr, newNodePtr);
-			subTreePtr->setLeftChildPtr(leftPtr);
-		}  // end if-else
+			if (leftPtr == nullptr)
+				currentPtr->setLeftChildPtr(newNodePtr); // end if-else
+			currentPtr = leftPtr;
+		} // end if-else
+	} // end while
 
-		return subTreePtr;
-	}  // end if-else
+	updatePath(firstIndex);
+	return subTreePtr;
 } // end balancedAdd
 
 template<class ItemType>
 BinaryNode<ItemType>* BinaryNodeTree<ItemType>::moveValuesUpTree(BinaryNode<ItemType>* subTreePtr)
 {
-	BinaryNode<ItemType>* leftPtr = subTreePtr->getLeftChildPtr();
-	BinaryNode<ItemType>* rightPtr = subTreePtr->getRightChildPtr();
-	int leftHeight = getHeightHelper(leftPtr);
-	int rightHeight = getHeightHelper(rightPtr);
+	std::size_t firstIndex = pathBuffer.size();
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
 
-	if (leftHeight > rightHeight)
+	// Swap the item of the taller child up one level until a leaf is reached.
+	// The target item travels down and is destroyed with the leaf.
+	while (!currentPtr->isLeaf())
 	{
-		subTreePtr->setItem(leftPtr->getItem());
-		leftPtr = moveValuesUpTree(leftPtr);
-		subTreePtr->setLeftChildPtr(leftPtr);
-		return subTreePtr;
-	}
-	else
+		BinaryNode<ItemType>* leftPtr = currentPtr->getLeftChildPtr();
+		BinaryNode<ItemType>* rightPtr = currentPtr->getRightChildPtr();
+		BinaryNode<ItemType>* childPtr =
+			(getHeightHelper(leftPtr) > getHeightHelper(rightPtr)) ? leftPtr : rightPtr;
+
+		currentPtr->swapItem(*childPtr);
+		pathBuffer.push_back(currentPtr);
+		currentPtr = childPtr;
+	} // end while
+
+	// The leaf now holds the target item, so it is removed.
+	if (pathBuffer.size() == firstIndex)
 	{
-		if (rightPtr != nullptr)
-		{
-			subTreePtr->setItem(rightPtr->getItem());
-			rightPtr = moveValuesUpTree(rightPtr);
-			subTreePtr->setRightChildPtr(rightPtr);
-			return subTreePtr;
-		}
-		else
-		{
-			delete subTreePtr;	// This item was a leaf and is not important.
-			return nullptr;
-		}  // end if-else
-	}  // end if-else
+		deallocateNode(currentPtr);
+		return nullptr;
+	} // end if-else
+
+	BinaryNode<ItemType>* parentPtr = pathBuffer.back();
+	if (parentPtr->getLeftChildPtr() == currentPtr)
+		parentPtr->setLeftChildPtr(nullptr);
+	else
+		parentPtr->setRightChildPtr(nullptr); // end if-else
+	deallocateNode(currentPtr);
+
+	updatePath(firstIndex);
+	return subTreePtr;
 } // end moveValuesUpTree
 
 template<class ItemType>
 BinaryNode<ItemType>* BinaryNodeTree<ItemType>::removeValue(BinaryNode<ItemType>* subTreePtr,
-	const ItemType target,
+	const ItemType& target,
 	bool& success)
 {
 	if (subTreePtr == nullptr) // The item was not found here.
@@ -102,22 +132,51 @@ BinaryNode<ItemType>* BinaryNodeTree<ItemType>::removeValue(BinaryNode<ItemType>
 
 	if (subTreePtr->getItem() == target)	// Found the item.
 	{
-		subTreePtr = moveValuesUpTree(subTreePtr);
 		success = true;
-		return subTreePtr;
-	}
-	else
+		return moveValuesUpTree(subTreePtr);
+	} // end if-else
+
+	// Each frame holds a node on the current path and the next child to search:
+	// 0 for the left child, 1 for the right child and 2 when both are done.
+	std::vector<std::pair<BinaryNode<ItemType>*, int>> frames;
+	frames.push_back(std::make_pair(subTreePtr, 0));
+
+	while (!frames.empty())
 	{
-		BinaryNode<ItemType>* targetNodePtr = removeValue(subTreePtr->getLeftChildPtr(), target, success);
-		subTreePtr->setLeftChildPtr(targetNodePtr);
-		if (!success) // The right subTree does not need to be searched.
+		BinaryNode<ItemType>* parentPtr = frames.back().first;
+		int side = frames.back().second++;
+
+		if (side == 2)
 		{
-			targetNodePtr = removeValue(subTreePtr->getRightChildPtr(), target, success);
-			subTreePtr->setRightChildPtr(targetNodePtr);
-		}  // end if-else
+			frames.pop_back();
+			continue;
+		} // end if-else
 
-		return subTreePtr;
-	} // end if-else
+		BinaryNode<ItemType>* childPtr = (side == 0) ? parentPtr->getLeftChildPtr()
+			: parentPtr->getRightChildPtr();
+		if (childPtr == nullptr)
+			continue; // end if-else
+
+		if (childPtr->getItem() == target)	// Found the item.
+		{
+			childPtr = moveValuesUpTree(childPtr);
+			if (side == 0)
+				parentPtr->setLeftChildPtr(childPtr);
+			else
+				parentPtr->setRightChildPtr(childPtr); // end if-else
+
+			// Every node on the current path lost one descendant.
+			for (std::size_t i = frames.size(); i > 0; --i)
+				frames[i - 1].first->updateHeightAndSize(); // end for
+
+			success = true;
+			return subTreePtr;
+		} // end if-else
+
+		frames.push_back(std::make_pair(childPtr, 0));
+	} // end while
+
+	return subTreePtr;
 } // end removeValue
 
 template<class ItemType>
@@ -125,54 +184,505 @@ BinaryNode<ItemType>* BinaryNodeTree<ItemType>::findNode(BinaryNode<ItemType>* t
 	const ItemType& target,
 	bool& success) const
 {
-	if (treePtr == nullptr)	// The node was not found here.
-		return nullptr;
+	std::vector<BinaryNode<ItemType>*> nodeStack;
+	if (treePtr != nullptr)
+		nodeStack.push_back(treePtr); // end if-else
 
-	if (treePtr->getItem() == target)	// Found the node.
-	{
-		success = true;
-		return treePtr;
-	}
-	else
+	// Search in preorder: the right child is pushed first so the left is popped first.
+	while (!nodeStack.empty())
 	{
-		BinaryNode<ItemType>* targetNodePtr = findNode(treePtr->getLeftChildPtr(), target, success);
-		if (!success)	// The right subTree does not need to be searched.
+		BinaryNode<ItemType>* currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		if (currentPtr->getItem() == target)	// Found the node.
 		{
-			targetNodePtr = findNode(treePtr->getRightChildPtr(), target, success);
+			success = true;
+			return currentPtr;
 		} // end if-else
 
-		return targetNodePtr;
-	} // end if-else
+		if (currentPtr->getRightChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getRightChildPtr()); // end if-else
+		if (currentPtr->getLeftChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getLeftChildPtr()); // end if-else
+	} // end while
+
+	return nullptr;
 } // end findNode
 
 template<class ItemType>
-BinaryNode<ItemType>* BinaryNodeTree<ItemType>::copyTree(const BinaryNode<ItemType>* treePtr) const
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::copyTree(const BinaryNode<ItemType>* treePtr)
 {
-	BinaryNode<ItemType>* newTreePtr = nullptr;
+	if (treePtr == nullptr)
+		return nullptr; // end if-else
+	else if (isWorthForking(treePtr))
+		return copyTreeInParallel(treePtr); // end if-else
 
-	// Copy all the tree nodes during a preorder traversal.
-	if (treePtr != nullptr)
+	// Copy all the tree nodes during a preorder traversal. Each pair holds an
+	// original node and its copy, whose children have not been copied yet. The
+	// copies have the same shape, so their heights and sizes are copied as well.
+	std::vector<std::pair<const BinaryNode<ItemType>*, BinaryNode<ItemType>*>> nodeStack;
+	BinaryNode<ItemType>* newTreePtr = allocateNode(treePtr->getItem());
+	newTreePtr->setHeight(treePtr->getHeight());
+	newTreePtr->setSize(treePtr->getSize());
+	nodeStack.push_back(std::make_pair(treePtr, newTreePtr));
+
+	while (!nodeStack.empty())
 	{
-		// Copy the current node.
-		newTreePtr = new BinaryNode<ItemType>(treePtr->getItem(), nullptr, nullptr);
-		newTreePtr->setLeftChildPtr(copyTree(treePtr->getLeftChildPtr()));
-		newTreePtr->setRightChildPtr(copyTree(treePtr->getRightChildPtr()));
-	} // end if-else
+		const BinaryNode<ItemType>* originalPtr = nodeStack.back().first;
+		BinaryNode<ItemType>* copyPtr = nodeStack.back().second;
+		nodeStack.pop_back();
+
+		const BinaryNode<ItemType>* leftPtr = originalPtr->getLeftChildPtr();
+		if (leftPtr != nullptr)
+		{
+			BinaryNode<ItemType>* newLeftPtr = allocateNode(leftPtr->getItem());
+			newLeftPtr->setHeight(leftPtr->getHeight());
+			newLeftPtr->setSize(leftPtr->getSize());
+			copyPtr->setLeftChildPtr(newLeftPtr);
+			nodeStack.push_back(std::make_pair(leftPtr, newLeftPtr));
+		} // end if-else
+
+		const BinaryNode<ItemType>* rightPtr = originalPtr->getRightChildPtr();
+		if (rightPtr != nullptr)
+		{
+			BinaryNode<ItemType>* newRightPtr = allocateNode(rightPtr->getItem());
+			newRightPtr->setHeight(rightPtr->getHeight());
+			newRightPtr->setSize(rightPtr->getSize());
+			copyPtr->setRightChildPtr(newRightPtr);
+			nodeStack.push_back(std::make_pair(rightPtr, newRightPtr));
+		} // end if-else
+	} // end while
 
 	return newTreePtr;
 } // end copyTree
 
+template<class ItemType>
+template<class... Args>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::allocateNode(Args&&... args)
+{
+	BinaryNode<ItemType>* nodePtr = nodePool.allocate(std::forward<Args>(args)...);
+	counters.countAllocations(1);
+	return nodePtr;
+} // end allocateNode
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::deallocateNode(BinaryNode<ItemType>* nodePtr)
+{
+	nodePool.deallocate(nodePtr);
+	counters.countDeallocations(1);
+} // end deallocateNode
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::reserveNodes(int count)
+{
+	nodePool.reserve(count);
+} // end reserveNodes
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::takeNodesFrom(BinaryNodeTree<ItemType>& sourceTree, int nodeCount)
+{
+	sourceTree.nodePool.shareWith(nodePool, nodeCount);
+} // end takeNodesFrom
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::allocateNodeBlock(int count)
+{
+	BinaryNode<ItemType>* blockPtr = nodePool.allocateBlock(count);
+	counters.countAllocations(count);
+	return blockPtr;
+} // end allocateNodeBlock
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::releaseNodeBlock(BinaryNode<ItemType>* blockPtr, int constructedCount, int count)
+{
+	for (int i = 0; i < constructedCount; ++i)
+		blockPtr[i].~BinaryNode<ItemType>(); // end for
+
+	nodePool.deallocateBlock(blockPtr, count);
+	counters.countDeallocations(count);
+} // end releaseNodeBlock
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::allocateLoadedNode(std::vector<BinaryNode<ItemType>*>& blocks,
+	int index, int count)
+{
+	if (index % LOAD_BLOCK_SIZE == 0)
+	{
+		// Make room for the pointer first, so that a new block is never lost.
+		int blockSize = (count - index < LOAD_BLOCK_SIZE) ? count - index : LOAD_BLOCK_SIZE;
+		blocks.push_back(nullptr);
+		blocks.back() = allocateNodeBlock(blockSize);
+	} // end if-else
+
+	return blocks.back() + index % LOAD_BLOCK_SIZE;
+} // end allocateLoadedNode
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::getLoadedNode(const std::vector<BinaryNode<ItemType>*>& blocks,
+	int index)
+{
+	return blocks[index / LOAD_BLOCK_SIZE] + index % LOAD_BLOCK_SIZE;
+} // end getLoadedNode
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::releaseLoadedNodes(const std::vector<BinaryNode<ItemType>*>& blocks,
+	int constructedCount, int count)
+{
+	for (std::size_t i = 0; i < blocks.size() && blocks[i] != nullptr; ++i)
+	{
+		int firstIndex = static_cast<int>(i) * LOAD_BLOCK_SIZE;
+		int blockSize = (count - firstIndex < LOAD_BLOCK_SIZE) ? count - firstIndex : LOAD_BLOCK_SIZE;
+		int constructedInBlock = constructedCount - firstIndex;
+		if (constructedInBlock > blockSize)
+			constructedInBlock = blockSize;
+		else if (constructedInBlock < 0)
+			constructedInBlock = 0; // end if-else
+
+		releaseNodeBlock(blocks[i], constructedInBlock, blockSize);
+	} // end for
+} // end releaseLoadedNodes
+
 template<class ItemType>
 void BinaryNodeTree<ItemType>::destroyTree(BinaryNode<ItemType>* subTreePtr)
 {
-	if (subTreePtr != nullptr)
+	// Rotate left children up to the right until the current node has none,
+	// then delete it and continue with its right child. No extra memory is used.
+	while (subTreePtr != nullptr)
 	{
-		destroyTree(subTreePtr->getLeftChildPtr());
-		destroyTree(subTreePtr->getRightChildPtr());
-		delete subTreePtr;
-	}  // end if-else
+		BinaryNode<ItemType>* leftPtr = subTreePtr->getLeftChildPtr();
+
+		if (leftPtr != nullptr)
+		{
+			subTreePtr->setLeftChildPtr(leftPtr->getRightChildPtr());
+			leftPtr->setRightChildPtr(subTreePtr);
+			subTreePtr = leftPtr;
+		}
+		else
+		{
+			BinaryNode<ItemType>* rightPtr = subTreePtr->getRightChildPtr();
+			deallocateNode(subTreePtr);
+			subTreePtr = rightPtr;
+		} // end if-else
+	} // end while
 } // end destroyTree
 
+template<class ItemType>
+void BinaryNodeTree<ItemType>::destroyAllNodes(BinaryNode<ItemType>* treeRootPtr)
+{
+	// Only destroyTree frees the nodes one at a time, which counts them.
+	int nodeCount = getNumberOfNodesHelper(treeRootPtr);
+
+	if (!std::is_trivially_destructible<ItemType>::value)
+	{
+		if (isWorthForking(treeRootPtr))
+		{
+			TaskGroup group;
+			destroySubtree(group, treeRootPtr);
+			group.wait();
+			counters.countDeallocations(nodeCount);
+		}
+		else
+			destroyTree(treeRootPtr); // end if-else
+	}
+	else
+		counters.countDeallocations(nodeCount); // end if-else
+
+	nodePool.releaseAll();
+} // end destroyAllNodes
+
+// -------------------------------------------------------------------------------------
+// Protected Parallel Methods Sub-Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+bool BinaryNodeTree<ItemType>::isWorthForking(const BinaryNode<ItemType>* treePtr)
+{
+	return treePtr != nullptr && treePtr->getSize() > 2 * PARALLEL_CUTOFF;
+} // end isWorthForking
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::copyTreeInParallel(const BinaryNode<ItemType>* treePtr)
+{
+	int count = treePtr->getSize();
+
+	// Items without a destructor need no record of which nodes were built.
+	std::vector<unsigned char> constructedFlags;
+	if (!std::is_trivially_destructible<ItemType>::value)
+		constructedFlags.assign(count, 0); // end if-else
+	unsigned char* flagsPtr = constructedFlags.empty() ? nullptr : constructedFlags.data();
+
+	BinaryNode<ItemType>* blockPtr = nodePool.allocateBlock(count);
+	counters.countAllocations(count);
+	try
+	{
+		BinaryNode<ItemType>* newTreePtr = copyNodeInto(treePtr, blockPtr, 0, flagsPtr);
+		TaskGroup group;
+		copySubtree(group, treePtr, newTreePtr, blockPtr, 1, count, flagsPtr);
+		group.wait();
+	}
+	catch (...)
+	{
+		for (std::size_t i = 0; i < constructedFlags.size(); ++i)
+		{
+			if (constructedFlags[i] != 0)
+				blockPtr[i].~BinaryNode<ItemType>(); // end if-else
+		} // end for
+
+		nodePool.deallocateBlock(blockPtr, count);
+		counters.countDeallocations(count);
+		throw;
+	} // end try-catch
+
+	return blockPtr;
+} // end copyTreeInParallel
+
+template<class ItemType>
+BinaryNode<ItemType>* BinaryNodeTree<ItemType>::copyNodeInto(const BinaryNode<ItemType>* originalPtr,
+	BinaryNode<ItemType>* blockPtr, int index, unsigned char* constructedFlags)
+{
+	BinaryNode<ItemType>* copyPtr = new (blockPtr + index) BinaryNode<ItemType>(originalPtr->getItem());
+	if (constructedFlags != nullptr)
+		constructedFlags[index] = 1; // end if-else
+
+	copyPtr->setHeight(originalPtr->getHeight());
+	copyPtr->setSize(originalPtr->getSize());
+	return copyPtr;
+} // end copyNodeInto
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::copySubtree(TaskGroup& group, const BinaryNode<ItemType>* treePtr,
+	BinaryNode<ItemType>* copyPtr, BinaryNode<ItemType>* blockPtr, int firstIndex, int endIndex,
+	unsigned char* constructedFlags)
+{
+	// Copy the nodes during a preorder traversal, like copyTree, taking the
+	// slots for both children of a node from the front of the range. A forked
+	// subtree takes as many slots as it has nodes from the back of the range.
+	std::vector<std::pair<const BinaryNode<ItemType>*, BinaryNode<ItemType>*>> nodeStack;
+	nodeStack.push_back(std::make_pair(treePtr, copyPtr));
+
+	while (!nodeStack.empty())
+	{
+		const BinaryNode<ItemType>* originalPtr = nodeStack.back().first;
+		BinaryNode<ItemType>* parentCopyPtr = nodeStack.back().second;
+		nodeStack.pop_back();
+
+		const BinaryNode<ItemType>* leftPtr = originalPtr->getLeftChildPtr();
+		const BinaryNode<ItemType>* rightPtr = originalPtr->getRightChildPtr();
+		bool isLeftForked = false;
+		bool isRightForked = false;
+
+		if (leftPtr != nullptr && rightPtr != nullptr && leftPtr->getSize() > PARALLEL_CUTOFF
+			&& rightPtr->getSize() > PARALLEL_CUTOFF)
+		{
+			// Fork the smaller child and keep copying the larger one.
+			isLeftForked = leftPtr->getSize() < rightPtr->getSize();
+			isRightForked = !isLeftForked;
+			const BinaryNode<ItemType>* forkedPtr = isLeftForked ? leftPtr : rightPtr;
+			int forkedIndex = endIndex - forkedPtr->getSize();
+			endIndex = forkedIndex;
+
+			BinaryNode<ItemType>* forkedCopyPtr = copyNodeInto(forkedPtr, blockPtr, forkedIndex, constructedFlags);
+			if (isLeftForked)
+				parentCopyPtr->setLeftChildPtr(forkedCopyPtr);
+			else
+				parentCopyPtr->setRightChildPtr(forkedCopyPtr); // end if-else
+
+			group.run([&group, forkedPtr, forkedCopyPtr, blockPtr, forkedIndex, constructedFlags]()
+			{
+				copySubtree(group, forkedPtr, forkedCopyPtr, blockPtr, forkedIndex + 1,
+					forkedIndex + forkedPtr->getSize(), constructedFlags);
+			});
+		} // end if-else
+
+		if (leftPtr != nullptr && !isLeftForked)
+		{
+			BinaryNode<ItemType>* newLeftPtr = copyNodeInto(leftPtr, blockPtr, firstIndex++, constructedFlags);
+			parentCopyPtr->setLeftChildPtr(newLeftPtr);
+			nodeStack.push_back(std::make_pair(leftPtr, newLeftPtr));
+		} // end if-else
+
+		if (rightPtr != nullptr && !isRightForked)
+		{
+			BinaryNode<ItemType>* newRightPtr = copyNodeInto(rightPtr, blockPtr, firstIndex++, constructedFlags);
+			parentCopyPtr->setRightChildPtr(newRightPtr);
+			nodeStack.push_back(std::make_pair(rightPtr, newRightPtr));
+		} // end if-else
+	} // end while
+} // end copySubtree
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::destroySubtree(TaskGroup& group, BinaryNode<ItemType>* subTreePtr)
+{
+	std::vector<BinaryNode<ItemType>*> nodeStack;
+	nodeStack.push_back(subTreePtr);
+
+	while (!nodeStack.empty())
+	{
+		BinaryNode<ItemType>* nodePtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		BinaryNode<ItemType>* leftPtr = nodePtr->getLeftChildPtr();
+		BinaryNode<ItemType>* rightPtr = nodePtr->getRightChildPtr();
+
+		if (leftPtr != nullptr && rightPtr != nullptr && leftPtr->getSize() > PARALLEL_CUTOFF
+			&& rightPtr->getSize() > PARALLEL_CUTOFF)
+		{
+			// Fork the smaller child and keep destroying the larger one.
+			bool isLeftForked = leftPtr->getSize() < rightPtr->getSize();
+			BinaryNode<ItemType>* forkedPtr = isLeftForked ? leftPtr : rightPtr;
+			group.run([&group, forkedPtr]()
+			{
+				destroySubtree(group, forkedPtr);
+			});
+			nodeStack.push_back(isLeftForked ? rightPtr : leftPtr);
+		}
+		else
+		{
+			if (rightPtr != nullptr)
+				nodeStack.push_back(rightPtr); // end if-else
+			if (leftPtr != nullptr)
+				nodeStack.push_back(leftPtr); // end if-else
+		} // end if-else
+
+		nodePtr->~BinaryNode<ItemType>();
+	} // end while
+} // end destroySubtree
+
+template<class ItemType>
+template<class Visitor>
+void BinaryNodeTree<ItemType>::parallelForEachHelper(Visitor& visit, const BinaryNode<ItemType>* treePtr) const
+{
+	if (treePtr == nullptr)
+		return; // end if-else
+
+	TaskGroup group;
+	forEachInSubtree(group, visit, treePtr);
+	group.wait();
+} // end parallelForEachHelper
+
+template<class ItemType>
+template<class Visitor>
+void BinaryNodeTree<ItemType>::forEachInSubtree(TaskGroup& group, Visitor& visit,
+	const BinaryNode<ItemType>* treePtr)
+{
+	std::vector<const BinaryNode<ItemType>*> nodeStack;
+	nodeStack.push_back(treePtr);
+
+	while (!nodeStack.empty())
+	{
+		const BinaryNode<ItemType>* nodePtr = nodeStack.back();
+		nodeStack.pop_back();
+		visit(nodePtr->getItem());
+
+		const BinaryNode<ItemType>* leftPtr = nodePtr->getLeftChildPtr();
+		const BinaryNode<ItemType>* rightPtr = nodePtr->getRightChildPtr();
+
+		if (leftPtr != nullptr && rightPtr != nullptr && leftPtr->getSize() > PARALLEL_CUTOFF
+			&& rightPtr->getSize() > PARALLEL_CUTOFF)
+		{
+			// Fork the smaller child and keep visiting the larger one.
+			bool isLeftForked = leftPtr->getSize() < rightPtr->getSize();
+			const BinaryNode<ItemType>* forkedPtr = isLeftForked ? leftPtr : rightPtr;
+			group.run([&group, &visit, forkedPtr]()
+			{
+				forEachInSubtree(group, visit, forkedPtr);
+			});
+			nodeStack.push_back(isLeftForked ? rightPtr : leftPtr);
+		}
+		else
+		{
+			if (rightPtr != nullptr)
+				nodeStack.push_back(rightPtr); // end if-else
+			if (leftPtr != nullptr)
+				nodeStack.push_back(leftPtr); // end if-else
+		} // end if-else
+	} // end while
+} // end forEachInSubtree
+
+template<class ItemType>
+template<class Map, class Combine>
+typename BinaryNodeTree<ItemType>::template ReduceResult<Map> BinaryNodeTree<ItemType>::parallelReduceHelper(
+	Map& map, Combine& combine, const BinaryNode<ItemType>* treePtr) const
+{
+	using Result = ReduceResult<Map>;
+
+	auto reduceInorder = [this, &map, &combine](const BinaryNode<ItemType>* subTreePtr)
+	{
+		std::optional<Result> result;
+		auto accumulate = [&map, &combine, &result](const ItemType& anItem)
+		{
+			if (result)
+				result = combine(std::move(*result), map(anItem));
+			else
+				result = map(anItem); // end if-else
+		};
+		inorderVisit(accumulate, subTreePtr);
+		return result;
+	};
+
+	// Walk down the larger child of every node and record the path. The
+	// child on the other side is reduced by a forked task if it is large,
+	// or right away if not. The node of each step lies between its two
+	// sides, so the results are combined bottom-up in inorder.
+	struct PathStep
+	{
+		const BinaryNode<ItemType>* nodePtr;
+		bool isLeftKept;
+		std::optional<Result> otherResult;
+	}; // end PathStep
+
+	std::deque<PathStep> path;	// Keeps its elements in place while the tasks write them.
+	std::optional<Result> keptResult;
+	TaskGroup group;
+
+	const BinaryNode<ItemType>* currentPtr = treePtr;
+	while (isWorthForking(currentPtr))
+	{
+		const BinaryNode<ItemType>* leftPtr = currentPtr->getLeftChildPtr();
+		const BinaryNode<ItemType>* rightPtr = currentPtr->getRightChildPtr();
+		int leftSize = (leftPtr != nullptr) ? leftPtr->getSize() : 0;
+		int rightSize = (rightPtr != nullptr) ? rightPtr->getSize() : 0;
+		bool isLeftKept = leftSize >= rightSize;
+		const BinaryNode<ItemType>* otherPtr = isLeftKept ? rightPtr : leftPtr;
+
+		path.push_back(PathStep{ currentPtr, isLeftKept, std::nullopt });
+		if (otherPtr != nullptr)
+		{
+			std::optional<Result>& otherResult = path.back().otherResult;
+			if (otherPtr->getSize() > PARALLEL_CUTOFF)
+			{
+				group.run([this, &map, &combine, &otherResult, otherPtr]()
+				{
+					otherResult = parallelReduceHelper(map, combine, otherPtr);
+				});
+			}
+			else
+				otherResult = reduceInorder(otherPtr); // end if-else
+		} // end if-else
+
+		currentPtr = isLeftKept ? leftPtr : rightPtr;
+	} // end while
+
+	if (currentPtr != nullptr)
+		keptResult = reduceInorder(currentPtr); // end if-else
+	group.wait();
+
+	for (auto stepIterator = path.rbegin(); stepIterator != path.rend(); ++stepIterator)
+	{
+		std::optional<Result>& leftResult = stepIterator->isLeftKept ? keptResult : stepIterator->otherResult;
+		std::optional<Result>& rightResult = stepIterator->isLeftKept ? stepIterator->otherResult : keptResult;
+
+		Result nodeResult = map(stepIterator->nodePtr->getItem());
+		if (leftResult)
+			nodeResult = combine(std::move(*leftResult), std::move(nodeResult)); // end if-else
+		if (rightResult)
+			nodeResult = combine(std::move(nodeResult), std::move(*rightResult)); // end if-else
+		keptResult = std::move(nodeResult);
+	} // end for
+
+	return std::move(*keptResult);
+} // end parallelReduceHelper
+
 // -------------------------------------------------------------------------------------
 // Protected Tree Traversal Sub-Section.
 // -------------------------------------------------------------------------------------
@@ -180,38 +690,175 @@ void BinaryNodeTree<ItemType>::destroyTree(BinaryNode<ItemType>* subTreePtr)
 template<class ItemType>
 void BinaryNodeTree<ItemType>::preorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const
 {
+	std::vector<BinaryNode<ItemType>*> nodeStack;
 	if (treePtr != nullptr)
+		nodeStack.push_back(treePtr); // end if-else
+
+	while (!nodeStack.empty())
 	{
-		ItemType theItem = treePtr->getItem();
+		BinaryNode<ItemType>* currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		ItemType theItem = currentPtr->getItem();
 		visit(theItem);
-		preorder(visit, treePtr->getLeftChildPtr());
-		preorder(visit, treePtr->getRightChildPtr());
-	}  // end if-else
+
+		if (currentPtr->getRightChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getRightChildPtr()); // end if-else
+		if (currentPtr->getLeftChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getLeftChildPtr()); // end if-else
+	} // end while
 } // end preorder
 
 template<class ItemType>
 void BinaryNodeTree<ItemType>::inorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const
 {
-	if (treePtr != nullptr)
+	std::vector<BinaryNode<ItemType>*> nodeStack;
+	BinaryNode<ItemType>* currentPtr = treePtr;
+
+	while (currentPtr != nullptr || !nodeStack.empty())
 	{
-		inorder(visit, treePtr->getLeftChildPtr());
-		ItemType theItem = treePtr->getItem();
+		// Push the whole left spine, then visit the deepest node and move right.
+		while (currentPtr != nullptr)
+		{
+			nodeStack.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end while
+
+		currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		ItemType theItem = currentPtr->getItem();
 		visit(theItem);
-		inorder(visit, treePtr->getRightChildPtr());
-	}  // end if-else
+
+		currentPtr = currentPtr->getRightChildPtr();
+	} // end while
 } // end inorder
 
 template<class ItemType>
 void BinaryNodeTree<ItemType>::postorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const
 {
+	std::vector<BinaryNode<ItemType>*> nodeStack;
+	BinaryNode<ItemType>* currentPtr = treePtr;
+	BinaryNode<ItemType>* lastVisitedPtr = nullptr;
+
+	while (currentPtr != nullptr || !nodeStack.empty())
+	{
+		while (currentPtr != nullptr)
+		{
+			nodeStack.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end while
+
+		// A node is visited once its right subtree is empty or was just visited.
+		BinaryNode<ItemType>* topPtr = nodeStack.back();
+		BinaryNode<ItemType>* rightPtr = topPtr->getRightChildPtr();
+		if (rightPtr != nullptr && rightPtr != lastVisitedPtr)
+			currentPtr = rightPtr;
+		else
+		{
+			nodeStack.pop_back();
+
+			ItemType theItem = topPtr->getItem();
+			visit(theItem);
+
+			lastVisitedPtr = topPtr;
+		} // end if-else
+	} // end while
+} // end postorder
+
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::preorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const
+{
+	std::vector<const BinaryNode<ItemType>*> nodeStack;
 	if (treePtr != nullptr)
 	{
-		postorder(visit, treePtr->getLeftChildPtr());
-		postorder(visit, treePtr->getRightChildPtr());
-		ItemType theItem = treePtr->getItem();
-		visit(theItem);
+		nodeStack.reserve(treePtr->getHeight() + 1);
+		nodeStack.push_back(treePtr);
 	} // end if-else
-} // end postorder
+
+	while (!nodeStack.empty())
+	{
+		const BinaryNode<ItemType>* currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		if (!applyVisitor(visit, currentPtr->getItem()))
+			return false; // end if-else
+
+		if (currentPtr->getRightChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getRightChildPtr()); // end if-else
+		if (currentPtr->getLeftChildPtr() != nullptr)
+			nodeStack.push_back(currentPtr->getLeftChildPtr()); // end if-else
+	} // end while
+
+	return true;
+} // end preorderVisit
+
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::inorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const
+{
+	std::vector<const BinaryNode<ItemType>*> nodeStack;
+	if (treePtr != nullptr)
+		nodeStack.reserve(treePtr->getHeight()); // end if-else
+	const BinaryNode<ItemType>* currentPtr = treePtr;
+
+	while (currentPtr != nullptr || !nodeStack.empty())
+	{
+		while (currentPtr != nullptr)
+		{
+			nodeStack.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end while
+
+		currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		if (!applyVisitor(visit, currentPtr->getItem()))
+			return false; // end if-else
+
+		currentPtr = currentPtr->getRightChildPtr();
+	} // end while
+
+	return true;
+} // end inorderVisit
+
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::postorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const
+{
+	std::vector<const BinaryNode<ItemType>*> nodeStack;
+	if (treePtr != nullptr)
+		nodeStack.reserve(treePtr->getHeight()); // end if-else
+	const BinaryNode<ItemType>* currentPtr = treePtr;
+	const BinaryNode<ItemType>* lastVisitedPtr = nullptr;
+
+	while (currentPtr != nullptr || !nodeStack.empty())
+	{
+		while (currentPtr != nullptr)
+		{
+			nodeStack.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end while
+
+		// A node is visited once its right subtree is empty or was just visited.
+		const BinaryNode<ItemType>* topPtr = nodeStack.back();
+		const BinaryNode<ItemType>* rightPtr = topPtr->getRightChildPtr();
+		if (rightPtr != nullptr && rightPtr != lastVisitedPtr)
+			currentPtr = rightPtr;
+		else
+		{
+			nodeStack.pop_back();
+
+			if (!applyVisitor(visit, topPtr->getItem()))
+				return false; // end if-else
+
+			lastVisitedPtr = topPtr;
+		} // end if-else
+	} // end while
+
+	return true;
+} // end postorderVisit
 
 // -------------------------------------------------------------------------------------
 // Constructor and Destructor Section.
@@ -225,7 +872,7 @@ BinaryNodeTree<ItemType>::BinaryNodeTree() : rootPtr(nullptr)
 template<class ItemType>
 BinaryNodeTree<ItemType>::BinaryNodeTree(const ItemType& rootItem)
 {
-	rootPtr = new BinaryNode<ItemType>(rootItem, nullptr, nullptr);
+	rootPtr = allocateNode(rootItem);
 } // end parameterized constructor
 
 template<class ItemType>
@@ -233,7 +880,7 @@ BinaryNodeTree<ItemType>::BinaryNodeTree(const ItemType& rootItem,
 	const BinaryNodeTree<ItemType>* leftTreePtr,
 	const BinaryNodeTree<ItemType>* rightTreePtr)
 {
-	rootPtr = new BinaryNode<ItemType>(rootItem, copyTree(leftTreePtr->rootPtr),
+	rootPtr = allocateNode(rootItem, copyTree(leftTreePtr->rootPtr),
 		copyTree(rightTreePtr->rootPtr));
 } // end parameterized constructor
 
@@ -243,10 +890,17 @@ BinaryNodeTree<ItemType>::BinaryNodeTree(const BinaryNodeTree<ItemType>& treePtr
 	rootPtr = copyTree(treePtr.rootPtr);
 } // end parameterized copy constructor
 
+template<class ItemType>
+BinaryNodeTree<ItemType>::BinaryNodeTree(BinaryNodeTree<ItemType>&& tree) : rootPtr(tree.rootPtr),
+	nodePool(std::move(tree.nodePool))
+{
+	tree.rootPtr = nullptr;
+} // end move constructor
+
 template<class ItemType>
 BinaryNodeTree<ItemType>::~BinaryNodeTree()
 {
-	destroyTree(rootPtr);
+	destroyAllNodes(rootPtr);
 } // end destructor
 
 // -------------------------------------------------------------------------------------
@@ -275,12 +929,12 @@ int BinaryNodeTree<ItemType>::getNumberOfNodes() const
 template<class ItemType>
 void BinaryNodeTree<ItemType>::clear()
 {
-	destroyTree(rootPtr);
+	destroyAllNodes(rootPtr);
 	rootPtr = nullptr;
 } // end clear
 
 template<class ItemType>
-ItemType BinaryNodeTree<ItemType>::getRootData() const throw(PreconditionException)
+const ItemType& BinaryNodeTree<ItemType>::getRootData() const
 {
 	if (isEmpty())
 		throw PreconditionException("Function getRootData() was called with an empty tree."); // end if-else
@@ -292,7 +946,7 @@ template<class ItemType>
 void BinaryNodeTree<ItemType>::setRootData(const ItemType& newItem)
 {
 	if (isEmpty())
-		rootPtr = new BinaryNode<ItemType>(newItem, nullptr, nullptr);
+		rootPtr = allocateNode(newItem);
 	else
 		rootPtr->setItem(newItem); // end if-else
 } // end setRootData
@@ -300,11 +954,28 @@ void BinaryNodeTree<ItemType>::setRootData(const ItemType& newItem)
 template<class ItemType>
 bool BinaryNodeTree<ItemType>::add(const ItemType& newData)
 {
-	BinaryNode<ItemType>* newNodePtr = new BinaryNode<ItemType>(newData);
+	BinaryNode<ItemType>* newNodePtr = allocateNode(newData);
+	rootPtr = balancedAdd(rootPtr, newNodePtr);
+	return true;
+} // end add
+
+template<class ItemType>
+bool BinaryNodeTree<ItemType>::add(ItemType&& newData)
+{
+	BinaryNode<ItemType>* newNodePtr = allocateNode(std::move(newData));
 	rootPtr = balancedAdd(rootPtr, newNodePtr);
 	return true;
 } // end add
 
+template<class ItemType>
+template<class... Args>
+bool BinaryNodeTree<ItemType>::emplace(Args&&... args)
+{
+	BinaryNode<ItemType>* newNodePtr = allocateNode(std::piecewise_construct, std::forward<Args>(args)...);
+	rootPtr = balancedAdd(rootPtr, newNodePtr);
+	return true;
+} // end emplace
+
 template<class ItemType>
 bool BinaryNodeTree<ItemType>::remove(const ItemType& target)
 {
@@ -314,7 +985,7 @@ bool BinaryNodeTree<ItemType>::remove(const ItemType& target)
 } // end remove
 
 template<class ItemType>
-ItemType BinaryNodeTree<ItemType>::getEntry(const ItemType& anEntry) const throw(NotFoundException)
+const ItemType& BinaryNodeTree<ItemType>::getEntry(const ItemType& anEntry) const
 {
 	bool isSuccessful = false;
 	BinaryNode<ItemType>* binaryNodePtr = findNode(rootPtr, anEntry, isSuccessful);
@@ -333,6 +1004,24 @@ bool BinaryNodeTree<ItemType>::contains(const ItemType& anEntry) const
 	return isSuccessful;
 } // end contains
 
+template<class ItemType>
+NodePoolStatistics BinaryNodeTree<ItemType>::getAllocatorStatistics() const
+{
+	return nodePool.getStatistics();
+} // end getAllocatorStatistics
+
+template<class ItemType>
+TreeStatistics BinaryNodeTree<ItemType>::getStatistics() const
+{
+	return counters.getStatistics();
+} // end getStatistics
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::resetStatistics()
+{
+	counters.reset();
+} // end resetStatistics
+
 // -------------------------------------------------------------------------------------
 // Public Traversals Section.
 // See @file BinaryTreeInterface.h for documentation.
@@ -356,6 +1045,190 @@ void BinaryNodeTree<ItemType>::postorderTraverse(void visit(ItemType&)) const
 	postorder(visit, rootPtr);
 } // end postorderTraverse
 
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::preorderTraverse(Visitor&& visit) const
+{
+	return preorderVisit(visit, rootPtr);
+} // end preorderTraverse
+
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::inorderTraverse(Visitor&& visit) const
+{
+	return inorderVisit(visit, rootPtr);
+} // end inorderTraverse
+
+template<class ItemType>
+template<class Visitor>
+bool BinaryNodeTree<ItemType>::postorderTraverse(Visitor&& visit) const
+{
+	return postorderVisit(visit, rootPtr);
+} // end postorderTraverse
+
+// -------------------------------------------------------------------------------------
+// Public Parallel Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+template<class Visitor>
+void BinaryNodeTree<ItemType>::parallelForEach(Visitor&& visit) const
+{
+	parallelForEachHelper(visit, rootPtr);
+} // end parallelForEach
+
+template<class ItemType>
+template<class Map, class Combine>
+typename BinaryNodeTree<ItemType>::template ReduceResult<Map> BinaryNodeTree<ItemType>::parallelReduce(
+	Map&& map, Combine&& combine) const
+{
+	if (rootPtr == nullptr)
+		return ReduceResult<Map>(); // end if-else
+
+	return parallelReduceHelper(map, combine, rootPtr);
+} // end parallelReduce
+
+// -------------------------------------------------------------------------------------
+// Public Persistence Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::save(std::ostream& output) const
+{
+	BinaryWriter writer(output);
+	writer.writeHeader(TreeFileFormat::PREORDER_SHAPE, ItemCodec<ItemType>::TAG, getNumberOfNodesHelper(rootPtr));
+
+	// The stack holds the right children still to be written, so it is no
+	// deeper than the tree.
+	std::vector<const BinaryNode<ItemType>*> pendingNodes;
+	if (rootPtr != nullptr)
+		pendingNodes.push_back(rootPtr); // end if-else
+
+	while (!pendingNodes.empty())
+	{
+		const BinaryNode<ItemType>* nodePtr = pendingNodes.back();
+		pendingNodes.pop_back();
+
+		unsigned char flags = 0;
+		if (nodePtr->getLeftChildPtr() != nullptr)
+			flags |= TreeFileFormat::HAS_LEFT_CHILD; // end if-else
+		if (nodePtr->getRightChildPtr() != nullptr)
+			flags |= TreeFileFormat::HAS_RIGHT_CHILD; // end if-else
+
+		writer.writeByte(flags);
+		ItemCodec<ItemType>::write(writer, nodePtr->getItem());
+
+		if (nodePtr->getRightChildPtr() != nullptr)
+			pendingNodes.push_back(nodePtr->getRightChildPtr()); // end if-else
+		if (nodePtr->getLeftChildPtr() != nullptr)
+			pendingNodes.push_back(nodePtr->getLeftChildPtr()); // end if-else
+	} // end while
+
+	writer.flush();
+} // end save
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::save(const std::string& fileName) const
+{
+	std::ofstream file(fileName, std::ios_base::binary | std::ios_base::trunc);
+	if (!file)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	save(file);
+} // end save
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::load(std::istream& input)
+{
+	clear();
+
+	BinaryReader reader(input);
+	int count = reader.readHeader(TreeFileFormat::PREORDER_SHAPE, ItemCodec<ItemType>::TAG);
+	if (count > 0)
+	{
+		std::vector<BinaryNode<ItemType>*> blocks;
+		int constructedCount = 0;
+
+		try
+		{
+			// Each node goes where the flags of the nodes before it left
+			// room: below the last node, or as the right child of the
+			// nearest node whose right subtree has not been read yet.
+			std::vector<BinaryNode<ItemType>*> pendingNodes;
+			BinaryNode<ItemType>* parentPtr = nullptr;
+			bool isLeftChild = false;
+			bool isExpectingNode = true;
+
+			for (int i = 0; i < count; ++i)
+			{
+				unsigned char flags = reader.readByte();
+				if (!isExpectingNode || flags > (TreeFileFormat::HAS_LEFT_CHILD | TreeFileFormat::HAS_RIGHT_CHILD))
+					throw SerializationException("The stream holds a damaged tree."); // end if-else
+
+				BinaryNode<ItemType>* nodePtr = new (allocateLoadedNode(blocks, i, count))
+					BinaryNode<ItemType>(ItemCodec<ItemType>::read(reader));
+				++constructedCount;
+
+				if (parentPtr != nullptr && isLeftChild)
+					parentPtr->setLeftChildPtr(nodePtr);
+				else if (parentPtr != nullptr)
+					parentPtr->setRightChildPtr(nodePtr); // end if-else
+
+				bool hasLeftChild = (flags & TreeFileFormat::HAS_LEFT_CHILD) != 0;
+				bool hasRightChild = (flags & TreeFileFormat::HAS_RIGHT_CHILD) != 0;
+
+				if (hasLeftChild && hasRightChild)
+					pendingNodes.push_back(nodePtr); // end if-else
+
+				if (hasLeftChild || hasRightChild)
+				{
+					parentPtr = nodePtr;
+					isLeftChild = hasLeftChild;
+				}
+				else if (!pendingNodes.empty())
+				{
+					parentPtr = pendingNodes.back();
+					pendingNodes.pop_back();
+					isLeftChild = false;
+				}
+				else
+					isExpectingNode = false; // end if-else
+			} // end for
+
+			if (isExpectingNode)
+				throw SerializationException("The stream holds a damaged tree."); // end if-else
+		}
+		catch (const std::bad_alloc&)
+		{
+			releaseLoadedNodes(blocks, constructedCount, count);
+			throw SerializationException("The tree does not fit in memory.");
+		}
+		catch (...)
+		{
+			releaseLoadedNodes(blocks, constructedCount, count);
+			throw;
+		} // end try-catch
+
+		// Every child comes after its parent in preorder, so going backwards
+		// refreshes the children first.
+		for (int i = count - 1; i >= 0; --i)
+			getLoadedNode(blocks, i)->updateHeightAndSize(); // end for
+		rootPtr = getLoadedNode(blocks, 0);
+	} // end if-else
+
+	reader.finish();
+} // end load
+
+template<class ItemType>
+void BinaryNodeTree<ItemType>::load(const std::string& fileName)
+{
+	std::ifstream file(fileName, std::ios_base::binary);
+	if (!file)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	load(file);
+} // end load
+
 // -------------------------------------------------------------------------------------
 // Overloaded Operator Section.
 // -------------------------------------------------------------------------------------
@@ -364,8 +1237,25 @@ template<class ItemType>
 BinaryNodeTree<ItemType>& BinaryNodeTree<ItemType>::operator=(
 	const BinaryNodeTree<ItemType>& rightHandSide)
 {
-	if (!isEmpty())
+	if (this != &rightHandSide)
+	{
+		clear();
+		rootPtr = copyTree(rightHandSide.rootPtr);
+	} // end if-else
+
+	return *this;
+} // end operator=
+
+template<class ItemType>
+BinaryNodeTree<ItemType>& BinaryNodeTree<ItemType>::operator=(BinaryNodeTree<ItemType>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
 		clear();
-	this = copyTree(&rightHandSide);
+		rootPtr = rightHandSide.rootPtr;
+		nodePool = std::move(rightHandSide.nodePool);
+		rightHandSide.rootPtr = nullptr;
+	} // end if-else
+
 	return *this;
 } // end operator=
@@ -9,47 +9,208 @@ operations with a binary tree.
 
 #pragma once
 
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "BinaryTreeInterface.h"
 #include "BinaryNode.h"
+#include "NodePool.h"
 #include "PreconditionException.h"
 #include "NotFoundException.h"
+#include "TreeSerialization.h"
+#include "TreeStatistics.h"
+#include "TreeVisitor.h"
+#include "WorkStealingPool.h"
 
 template<class ItemType>
 class BinaryNodeTree : public BinaryTreeInterface<ItemType>
 {
 private:
 	BinaryNode<ItemType>* rootPtr;	// Pointer to the root node.
+	NodePool<ItemType> nodePool;	// Allocator for all nodes of this tree.
+	std::vector<BinaryNode<ItemType>*> pathBuffer;	// Scratch path reused by the helpers.
+	TreeCounters counters;			// Work counted on the hot paths, if compiled in.
 
 protected:
+	// Subtrees of at most this many nodes are never split between threads.
+	static const int PARALLEL_CUTOFF = 1 << 14;
+
+	// Node slots taken from the node pool at a time while loading a tree.
+	static const int LOAD_BLOCK_SIZE = 1 << 16;
+
+	// The type parallelReduce returns for a given map.
+	template<class Map>
+	using ReduceResult = typename std::decay<decltype(std::declval<Map&>()(std::declval<const ItemType&>()))>::type;
+
 	//-------------------------------------------------------------------------------------
 	// Protected Utility Methods Section:
-	// Recursive helper methods for the public methods.
+	// Iterative helper methods for the public methods. Their stack usage
+	// is bounded regardless of the shape of the tree.
 	//-------------------------------------------------------------------------------------
 
 	/**
-	Recursive utility function for getting the height of this subtree.
+	Utility function for getting the height of this subtree. Reads the
+	height cached in the subtree's root node, so it runs in O(1).
 	@param		BinaryNode<ItemType>* subTreePtr
 	@return		The height of this subtree.
 	*/
 	int getHeightHelper(BinaryNode<ItemType>* subTreePtr) const;
 
 	/**
-	Recursive utility function for getting the number of nodes of
-	this subtree.
+	Utility function for getting the number of nodes of this subtree.
+	Reads the size cached in the subtree's root node, so it runs in O(1).
 	@param		BinaryNode<ItemType>* subTreePtr
 	@return		The number of nodes of this subtree.
 	*/
 	int getNumberOfNodesHelper(BinaryNode<ItemType>* subTreePtr) const;
 
 	/**
-	Recursive utility function for deleting all the nodes from the subtree.
+	Returns the scratch vector in which the iterative helpers record the
+	nodes on the path from a subtree root down to the node they change, so
+	that the cached heights and sizes can be refreshed afterwards. It is
+	reused between calls to avoid allocating on every operation. Helpers
+	push onto it and pop their own entries with updatePath, so they may
+	call one another.
+	@return		A reference to the path buffer.
+	*/
+	std::vector<BinaryNode<ItemType>*>& getPathBuffer();
+
+	/**
+	Returns the counters in which the helpers record their work. Their
+	methods do nothing unless BST_ENABLE_STATISTICS is defined.
+	@return		A reference to the counters of this tree.
+	*/
+	const TreeCounters& getCounters() const;
+
+	/**
+	Refreshes the cached height and size of every node in the path buffer
+	at or after firstIndex, deepest node first, and removes those nodes
+	from the buffer.
+	@param		std::size_t firstIndex
+	@return		void
+	*/
+	void updatePath(std::size_t firstIndex);
+
+	/**
+	Allocates a new node for this tree from its node pool, forwarding the
+	given arguments to a constructor of BinaryNode.
+	@param		Args&&... args
+	@return		A pointer to the new node.
+	*/
+	template<class... Args>
+	BinaryNode<ItemType>* allocateNode(Args&&... args);
+
+	/**
+	Destroys a single node of this tree and returns it to the node pool.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		void
+	*/
+	void deallocateNode(BinaryNode<ItemType>* nodePtr);
+
+	/**
+	Makes sure that the node pool of this tree can hold the given number
+	of additional nodes without adding another slab.
+	@param		int count
+	@return		void
+	*/
+	void reserveNodes(int count);
+
+	/**
+	Takes over nodeCount nodes of sourceTree without moving them, by giving
+	the node pool of this tree a share of the slabs of sourceTree. Used to
+	relink nodes from one tree into another.
+	@pre		The caller moves exactly nodeCount nodes of sourceTree
+					into this tree.
+	@param		BinaryNodeTree<ItemType>& sourceTree
+	@param		int nodeCount
+	@return		void
+	*/
+	void takeNodesFrom(BinaryNodeTree<ItemType>& sourceTree, int nodeCount);
+
+	/**
+	Takes count consecutive unconstructed node slots from the node pool of
+	this tree, in which the caller constructs the nodes of a whole tree.
+	@param		int count
+	@return		A pointer to the first slot.
+	*/
+	BinaryNode<ItemType>* allocateNodeBlock(int count);
+
+	/**
+	Destroys the first constructedCount nodes of a block from
+	allocateNodeBlock and returns all of its slots to the node pool, when
+	building a tree in it failed.
+	@pre		Exactly the first constructedCount nodes of the block
+					were constructed.
+	@param		BinaryNode<ItemType>* blockPtr
+	@param		int constructedCount
+	@param		int count
+	@return		void
+	*/
+	void releaseNodeBlock(BinaryNode<ItemType>* blockPtr, int constructedCount, int count);
+
+	/**
+	Returns the slot for node index of count nodes that are loaded from a
+	stream. The slots are taken in blocks of at most LOAD_BLOCK_SIZE as
+	the nodes arrive, so a header whose count is damaged or forged costs
+	one block at most instead of memory for the whole count.
+	@pre		index is 0 or one more than in the previous call with
+					blocks, and index < count.
+	@param		std::vector<BinaryNode<ItemType>*>& blocks
+	@param		int index
+	@param		int count
+	@return		A pointer to an unconstructed slot.
+	*/
+	BinaryNode<ItemType>* allocateLoadedNode(std::vector<BinaryNode<ItemType>*>& blocks, int index, int count);
+
+	/**
+	Returns node index of the blocks filled by allocateLoadedNode.
+	@param		const std::vector<BinaryNode<ItemType>*>& blocks
+	@param		int index
+	@return		A pointer to the node.
+	*/
+	static BinaryNode<ItemType>* getLoadedNode(const std::vector<BinaryNode<ItemType>*>& blocks, int index);
+
+	/**
+	Destroys the first constructedCount nodes of the blocks filled by
+	allocateLoadedNode and returns all of their slots to the node pool,
+	when loading a tree failed.
+	@pre		Exactly the first constructedCount nodes were constructed.
+	@param		const std::vector<BinaryNode<ItemType>*>& blocks
+	@param		int constructedCount
+	@param		int count
+	@return		void
+	*/
+	void releaseLoadedNodes(const std::vector<BinaryNode<ItemType>*>& blocks, int constructedCount, int count);
+
+	/**
+	Utility function for deleting all the nodes from the subtree. Rotates
+	left children to the right as it goes, so it needs no stack.
 	@param		BinaryNode<ItemType>* subTreePtr
 	@return		void
 	*/
 	void destroyTree(BinaryNode<ItemType>* subTreePtr);
 
 	/**
-	Recursive utility function that adds a new node to the tree in a left/right
+	Deletes every node of this tree. The nodes are only visited when
+	ItemType has a destructor to run; the slabs of the node pool are
+	then released all at once.
+	@pre		treeRootPtr is the root of the whole tree.
+	@post		The node pool is empty.
+	@param		BinaryNode<ItemType>* treeRootPtr
+	@return		void
+	*/
+	void destroyAllNodes(BinaryNode<ItemType>* treeRootPtr);
+
+	/**
+	Utility function that adds a new node to the tree in a left/right
 	fashion to maintain the tree's balance.
 	@post		The new node has been added to the tree and the tree
 					is balanced.
@@ -69,17 +230,17 @@ protected:
 					any values have been moved up the tree, maintaining
 					the tree's balance.
 	@param		BinaryNode<ItemType>* subTreePtr
-	@param		const ItemType target
+	@param		const ItemType& target
 	@param		bool& success
 	@return		A pointer to the subtree, or nullptr if the tree is empty.
 	*/
 	BinaryNode<ItemType>* removeValue(BinaryNode<ItemType>* subTreePtr,
-		const ItemType target, bool& success);
+		const ItemType& target, bool& success);
 
 	/**
-	Copies the data items up the tree to overwrite a data item in the current
-	node until a leaf is reached. The leaf is then removed because its item
-	is stored in the parent node.
+	Swaps the data items up the tree to overwrite a data item in the current
+	node until a leaf is reached, so no item is copied. The leaf, which now
+	holds the removed item, is then deleted.
 	@pre		The node is not a leaf.
 	@post		The data items have been moved up the tree, maintaining
 					the tree's balance.
@@ -89,8 +250,8 @@ protected:
 	BinaryNode<ItemType>* moveValuesUpTree(BinaryNode<ItemType>* subTreePtr);
 
 	/**
-	Recursive function for searching for the target data item in the tree
-	by using a preorder traversal of the tree.
+	Function for searching for the target data item in the tree by using
+	a preorder traversal of the tree with an explicit stack.
 	@pre		The tree is not empty.
 	@param		BinaryNode<ItemType>* treePtr
 	@param		const ItemType& target
@@ -109,10 +270,110 @@ protected:
 	@return		A pointer to the copy of the tree, or nullptr if the tree
 					was empty.
 	*/
-	BinaryNode<ItemType>* copyTree(const BinaryNode<ItemType>* treePtr) const;
+	BinaryNode<ItemType>* copyTree(const BinaryNode<ItemType>* treePtr);
+
+	//-------------------------------------------------------------------------------------
+	// Protected Parallel Methods Sub-Section:
+	// Helpers that split the work on a large subtree between the threads of
+	// the default WorkStealingPool. A thread keeps the larger child of every
+	// node for itself and forks the smaller one if it holds more than
+	// PARALLEL_CUTOFF nodes, so a degenerate tree simply runs on one thread.
+	// Data items are copied, destroyed and visited concurrently, so these
+	// operations on ItemType must be safe to run on different items at once.
+	//-------------------------------------------------------------------------------------
+
+	/**
+	Returns whether a subtree is large enough to split between threads.
+	@param		const BinaryNode<ItemType>* treePtr
+	@return		True if the subtree holds more than 2 * PARALLEL_CUTOFF
+					nodes, or false if not.
+	*/
+	static bool isWorthForking(const BinaryNode<ItemType>* treePtr);
+
+	/**
+	Copies the tree rooted at treePtr on several threads. The copy fills
+	one block of the node pool, and every task builds its subtree in its
+	own range of that block, so the threads never share the pool.
+	@pre		treePtr is not nullptr.
+	@post		The tree was copied, or nothing was allocated if copying a
+					data item threw.
+	@param		const BinaryNode<ItemType>* treePtr
+	@return		A pointer to the copy of the tree.
+	*/
+	BinaryNode<ItemType>* copyTreeInParallel(const BinaryNode<ItemType>* treePtr);
+
+	/**
+	Constructs a copy of a single node, with its height and size, in the
+	given slot of a block.
+	@param		const BinaryNode<ItemType>* originalPtr
+	@param		BinaryNode<ItemType>* blockPtr
+	@param		int index
+	@param		unsigned char* constructedFlags
+					One flag per slot of the block, set when a node is
+					constructed in it, or nullptr if none are kept.
+	@return		A pointer to the copy, which has no children yet.
+	*/
+	static BinaryNode<ItemType>* copyNodeInto(const BinaryNode<ItemType>* originalPtr,
+		BinaryNode<ItemType>* blockPtr, int index, unsigned char* constructedFlags);
 
 	/**
-	Recursive utility method for performing a preorder traversal of the tree.
+	Copies the descendants of treePtr below copyPtr, its copy, into the
+	slots of the block from firstIndex up to endIndex, forking large
+	subtrees into group.
+	@pre		The range holds one slot for every descendant of treePtr.
+	@param		TaskGroup& group
+	@param		const BinaryNode<ItemType>* treePtr
+	@param		BinaryNode<ItemType>* copyPtr
+	@param		BinaryNode<ItemType>* blockPtr
+	@param		int firstIndex
+	@param		int endIndex
+	@param		unsigned char* constructedFlags
+	@return		void
+	*/
+	static void copySubtree(TaskGroup& group, const BinaryNode<ItemType>* treePtr,
+		BinaryNode<ItemType>* copyPtr, BinaryNode<ItemType>* blockPtr, int firstIndex, int endIndex,
+		unsigned char* constructedFlags);
+
+	/**
+	Runs the destructor of every node of the subtree rooted at subTreePtr
+	without returning the nodes to the node pool, forking large subtrees
+	into group.
+	@post		The slabs of the node pool may be released.
+	@param		TaskGroup& group
+	@param		BinaryNode<ItemType>* subTreePtr
+	@return		void
+	*/
+	static void destroySubtree(TaskGroup& group, BinaryNode<ItemType>* subTreePtr);
+
+	/**
+	Calls visit once for every data item of the subtree rooted at treePtr,
+	in no particular order and from several threads at once.
+	@param		Visitor& visit
+	@param		const BinaryNode<ItemType>* treePtr
+	@return		void
+	*/
+	template<class Visitor>
+	void parallelForEachHelper(Visitor& visit, const BinaryNode<ItemType>* treePtr) const;
+	template<class Visitor>
+	static void forEachInSubtree(TaskGroup& group, Visitor& visit, const BinaryNode<ItemType>* treePtr);
+
+	/**
+	Maps every data item of the subtree rooted at treePtr and combines the
+	results in inorder on several threads, so combine has to be associative
+	but not commutative.
+	@pre		treePtr is not nullptr.
+	@param		Map& map
+	@param		Combine& combine
+	@param		const BinaryNode<ItemType>* treePtr
+	@return		The combined result of the subtree.
+	*/
+	template<class Map, class Combine>
+	ReduceResult<Map> parallelReduceHelper(Map& map, Combine& combine,
+		const BinaryNode<ItemType>* treePtr) const;
+
+	/**
+	Utility method for performing a preorder traversal of the tree with an
+	explicit stack.
 	@param		void visit(ItemType&)
 	@param		BinaryNode<ItemType>* treePtr
 	@return		void
@@ -120,7 +381,8 @@ protected:
 	void preorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const;
 
 	/**
-	Recursive utility method for performing an inorder traversal of the tree.
+	Utility method for performing an inorder traversal of the tree with an
+	explicit stack.
 	@param		void visit(ItemType&)
 	@param		BinaryNode<ItemType>* treePtr
 	@return		void
@@ -128,13 +390,31 @@ protected:
 	void inorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const;
 
 	/**
-	Recursive utility method for performing a postorder traversal of the tree.
+	Utility method for performing a postorder traversal of the tree with an
+	explicit stack.
 	@param		void visit(ItemType&)
 	@param		BinaryNode<ItemType>* treePtr
 	@return		void
 	*/
 	void postorder(void visit(ItemType&), BinaryNode<ItemType>* treePtr) const;
 
+	/**
+	Templated utility methods for traversing the subtree rooted at treePtr
+	in preorder, inorder or postorder with an explicit stack. They pass
+	each data item to visit by constant reference without copying it, and
+	stop as soon as visit returns false.
+	@param		Visitor& visit
+	@param		const BinaryNode<ItemType>* treePtr
+	@return		True if every node was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	bool preorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const;
+	template<class Visitor>
+	bool inorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const;
+	template<class Visitor>
+	bool postorderVisit(Visitor& visit, const BinaryNode<ItemType>* treePtr) const;
+
 public:
 	//-------------------------------------------------------------------------------------
 	// Constructor and Destructor Section.
@@ -146,6 +426,7 @@ public:
 		const BinaryNodeTree<ItemType>* leftTreePtr,
 		const BinaryNodeTree<ItemType>* rightTreePtr);
 	BinaryNodeTree(const BinaryNodeTree<ItemType>& tree);
+	BinaryNodeTree(BinaryNodeTree<ItemType>&& tree);
 	virtual ~BinaryNodeTree();
 
 	//-------------------------------------------------------------------------------------
@@ -156,14 +437,57 @@ public:
 	bool isEmpty() const;
 	int getHeight() const;
 	int getNumberOfNodes() const;
-	ItemType getRootData() const throw(PreconditionException);
+	const ItemType& getRootData() const;
 	void setRootData(const ItemType& newData);
 	bool add(const ItemType& newData);
+
+	/**
+	Adds a new data item to this binary tree by moving it into a new node.
+	@post		The binary tree contains the new data item.
+	@param		ItemType&& newData
+	@return		True if the addition was successful, or false if not.
+	*/
+	bool add(ItemType&& newData);
+
+	/**
+	Adds a new data item to this binary tree, constructing it in place in
+	a new node from the given constructor arguments.
+	@post		The binary tree contains the new data item.
+	@param		Args&&... args
+	@return		True if the addition was successful, or false if not.
+	*/
+	template<class... Args>
+	bool emplace(Args&&... args);
+
 	bool remove(const ItemType& data);
 	void clear();
-	ItemType getEntry(const ItemType& anEntry) const throw(NotFoundException);
+	const ItemType& getEntry(const ItemType& anEntry) const;
 	bool contains(const ItemType& anEntry) const;
 
+	/**
+	Returns the bookkeeping of the node pool of this tree: the number of
+	slabs, live nodes and free slots, which can be used to size it.
+	@return		The statistics of this tree's node pool.
+	*/
+	NodePoolStatistics getAllocatorStatistics() const;
+
+	/**
+	Returns the work counted on the hot paths of this tree since it was
+	built or the counts were last reset: comparisons, nodes visited, node
+	allocations and frees, rotations and the depths of lookups. See
+	@file TreeStatistics.h for the compile-time switch.
+	@return		A snapshot of the counters, all zero if they were not
+					compiled in.
+	*/
+	TreeStatistics getStatistics() const;
+
+	/**
+	Sets every counter of this tree back to zero.
+	@post		getStatistics() returns only zeros.
+	@return		void
+	*/
+	void resetStatistics();
+
 	//-------------------------------------------------------------------------------------
 	// Public Traversals Section.
 	// See @file BinaryTreeInterface.h for documentation.
@@ -173,19 +497,109 @@ public:
 	void inorderTraverse(void visit(ItemType&)) const;
 	void postorderTraverse(void visit(ItemType&)) const;
 
+	/**
+	Traverses this binary tree in preorder, inorder or postorder and calls
+	visit, which may be any callable such as a capturing lambda, once for
+	each node with a constant reference to its data item. If visit returns
+	a value, the traversal stops as soon as that value is false.
+	@post		The tree is unchanged.
+	@param		Visitor&& visit
+	@return		True if every node was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	bool preorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool postorderTraverse(Visitor&& visit) const;
+
+	//-------------------------------------------------------------------------------------
+	// Public Parallel Methods Section.
+	//-------------------------------------------------------------------------------------
+
+	/**
+	Calls visit once for each data item of this tree, in no particular
+	order, from the threads of the default WorkStealingPool. visit must be
+	safe to call from several threads at once.
+	@post		The tree is unchanged.
+	@param		Visitor&& visit
+	@return		void
+	*/
+	template<class Visitor>
+	void parallelForEach(Visitor&& visit) const;
+
+	/**
+	Maps every data item of this tree and combines the results in inorder,
+	splitting the work between the threads of the default WorkStealingPool.
+	map must be safe to call from several threads at once, and combine
+	must be associative.
+	@post		The tree is unchanged.
+	@param		Map&& map
+	@param		Combine&& combine
+	@return		The combined result, or a value-initialized result if the
+					tree is empty.
+	*/
+	template<class Map, class Combine>
+	ReduceResult<Map> parallelReduce(Map&& map, Combine&& combine) const;
+
+	//-------------------------------------------------------------------------------------
+	// Public Persistence Section.
+	// A binary tree is saved in the preorder shape layout of
+	// @file TreeSerialization.h: every node in preorder as a byte that tells
+	// which children it has, followed by its data item, so that loading
+	// restores the exact shape. The entries are written by ItemCodec.
+	//-------------------------------------------------------------------------------------
+
+	/**
+	Saves this tree to a stream, or to a file that is replaced.
+	@post		The tree is unchanged.
+	@param		std::ostream& output
+	@return		void
+	@throws		SerializationException if the stream fails or the file
+					cannot be opened.
+	*/
+	void save(std::ostream& output) const;
+	void save(const std::string& fileName) const;
+
+	/**
+	Replaces the entries of this tree with a tree saved by save, reading
+	the stream through a buffer of fixed size. The nodes are built in
+	preorder in blocks of the node pool that are taken as they are read.
+	@post		This tree has the saved shape and entries, or is empty
+					if loading failed.
+	@param		std::istream& input
+	@return		void
+	@throws		SerializationException if the stream does not hold a tree
+					saved in this layout with the same kind of entries, the
+					tree does not fit in memory, or the file cannot be
+					opened.
+	*/
+	void load(std::istream& input);
+	void load(const std::string& fileName);
+
 	//-------------------------------------------------------------------------------------
 	// Overloaded Operator Section.
 	//-------------------------------------------------------------------------------------
 
 	/**
 	Overloads the assignment operator = for clearing the tree and copying the
-	tree pointed to by rightHandSide to this tree. A pointer to this tree
+	tree pointed to by rightHandSide to this tree. A reference to this tree
 	is returned.
-	@post		rightHandSide is copied and a pointer to it is returned.
+	@post		rightHandSide is copied and a reference to this tree is returned.
 	@param		const BinaryNodeTree& rightHandSide
-	@return		A pointer to this tree.
+	@return		A reference to this tree.
 	*/
 	BinaryNodeTree& operator=(const BinaryNodeTree& rightHandSide);
+
+	/**
+	Overloads the assignment operator = for clearing the tree and taking
+	over the nodes and the node pool of rightHandSide without copying them.
+	@post		rightHandSide is empty.
+	@param		BinaryNodeTree&& rightHandSide
+	@return		A reference to this tree.
+	*/
+	BinaryNodeTree& operator=(BinaryNodeTree&& rightHandSide);
 }; // end BinaryNodeTree
 
 #include "BinaryNodeTree.cpp"
@@ -1,6 +1,8 @@
 /**
 This templated class provides methods for creating and performing
-operations on a binary search tree (BST).
+operations on a binary search tree (BST). The entries are ordered by
+Compare, a strict weak ordering that defaults to std::less, and every
+search makes a single comparison per level.
 
 @author		Solomon Colley
 @file		BinarySearchTree.cpp
@@ -14,179 +16,669 @@ operations on a binary search tree (BST).
 // Protected Utility Methods Section.
 // ---------------------------------------------------------------------------
 
-template<class ItemType>
-BinaryNode<ItemType>* BinarySearchTree<ItemType>::insertInorder(BinaryNode<ItemType>* subTreePtr,
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::insertInorder(BinaryNode<ItemType>* subTreePtr,
 	BinaryNode<ItemType>* newNodePtr)
 {
 	if (subTreePtr == nullptr)
-		return newNodePtr;
-	else
+		return newNodePtr; // end if-else
+
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+
+	while (currentPtr != nullptr)
 	{
-		if (subTreePtr->getItem() > newNodePtr->getItem())
-			subTreePtr->setLeftChildPtr(insertInorder(subTreePtr->getLeftChildPtr(), newNodePtr));
+		path.push_back(currentPtr);
+		this->getCounters().countVisit();
+
+		if (lessThan(newNodePtr->getItem(), currentPtr->getItem()))
+		{
+			if (currentPtr->getLeftChildPtr() == nullptr)
+				currentPtr->setLeftChildPtr(newNodePtr); // end if-else
+			currentPtr = currentPtr->getLeftChildPtr();
+		}
 		else
-			subTreePtr->setRightChildPtr(insertInorder(subTreePtr->getRightChildPtr(), newNodePtr)); // end if-else
+		{
+			if (currentPtr->getRightChildPtr() == nullptr)
+				currentPtr->setRightChildPtr(newNodePtr); // end if-else
+			currentPtr = currentPtr->getRightChildPtr();
+		} // end if-else
 
-		return subTreePtr;
-	} // end if-else
+		if (currentPtr == newNodePtr)
+			currentPtr = nullptr; // end if-else
+	} // end while
+
+	this->updatePath(firstIndex);
+	return subTreePtr;
 } // end insertInorder
 
-template<class ItemType>
-BinaryNode<ItemType>* BinarySearchTree<ItemType>::removeValue(BinaryNode<ItemType>* subTreePtr,
-	const ItemType target,
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::removeValue(BinaryNode<ItemType>* subTreePtr,
+	const ItemType& target,
 	bool& success)
 {
-	if (subTreePtr == nullptr) // The item was not found here.
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	std::size_t targetIndex = 0;
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+	BinaryNode<ItemType>* targetPtr = nullptr;
+
+	// Search for the first node that is not less than the target with one
+	// comparison per level, remembering the path down to it.
+	while (currentPtr != nullptr)
 	{
-		success = false;
-		return nullptr;
-	} // end if-else
-	if (subTreePtr->getItem() == target)
+		this->getCounters().countVisit();
+		if (lessThan(currentPtr->getItem(), target))
+		{
+			path.push_back(currentPtr);
+			currentPtr = currentPtr->getRightChildPtr();
+		}
+		else
+		{
+			targetPtr = currentPtr;
+			targetIndex = path.size();
+			path.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end if-else
+	} // end while
+
+	if (targetPtr == nullptr || lessThan(target, targetPtr->getItem())) // The item was not found.
 	{
-		// The item is in the root of some subtree.
-		subTreePtr = removeNode(subTreePtr);
-		success = true;
+		path.resize(firstIndex);
+		success = false;
 		return subTreePtr;
-	}
+	} // end if-else
+
+	path.resize(targetIndex);	// Keep only the ancestors of the target node.
+	bool isLeftChild = path.size() > firstIndex && path.back()->getLeftChildPtr() == targetPtr;
+
+	// The item is in the root of some subtree.
+	BinaryNode<ItemType>* replacementPtr = removeNode(targetPtr);
+	success = true;
+
+	if (path.size() == firstIndex)
+		return replacementPtr; // end if-else
+
+	BinaryNode<ItemType>* parentPtr = path.back();
+	if (isLeftChild)
+		parentPtr->setLeftChildPtr(replacementPtr);
 	else
-	{
-		if (subTreePtr->getItem() > target)
-			// Search the left subtree.
-			subTreePtr->setLeftChildPtr(removeValue(subTreePtr->getLeftChildPtr(), target, success));
-		else
-			// Search the right subtree.
-			subTreePtr->setRightChildPtr(removeValue(subTreePtr->getRightChildPtr(), target, success)); // end if-else
+		parentPtr->setRightChildPtr(replacementPtr); // end if-else
 
-		return subTreePtr;
-	}  // end if-else
+	this->updatePath(firstIndex);
+	return subTreePtr;
 } // end removeValue
 
-template<class ItemType>
-BinaryNode<ItemType>* BinarySearchTree<ItemType>::removeNode(BinaryNode<ItemType>* nodePtr)
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::removeNode(BinaryNode<ItemType>* nodePtr)
 {
 	// Case 1: The node is a leaf and it is deleted.
 	// Case 2: The node has one child and the parent adopts it.
-	// Case 3: The node has two children so find the successor node.
+	// Case 3: The node has two children so the successor node takes its place.
 	if (nodePtr->isLeaf())
 	{
-		delete nodePtr;
+		this->deallocateNode(nodePtr);
 		nodePtr = nullptr;
 		return nodePtr;
 	}
 	else if (nodePtr->getLeftChildPtr() == nullptr)	// This node only has a rightChild.
 	{
 		BinaryNode<ItemType>* nodeToConnectPtr = nodePtr->getRightChildPtr();
-		delete nodePtr;
+		this->deallocateNode(nodePtr);
 		nodePtr = nullptr;
 		return nodeToConnectPtr;
 	}
 	else if (nodePtr->getRightChildPtr() == nullptr)	// This node only has a leftChild.
 	{
 		BinaryNode<ItemType>* nodeToConnectPtr = nodePtr->getLeftChildPtr();
-		delete nodePtr;
+		this->deallocateNode(nodePtr);
 		nodePtr = nullptr;
 		return nodeToConnectPtr;
 	}
 	else	// This node has two children.
 	{
-		ItemType newNodeValue;
-		nodePtr->setRightChildPtr(removeLeftmostNode(nodePtr->getRightChildPtr(), newNodeValue));
-		nodePtr->setItem(newNodeValue);
-		return nodePtr;
+		BinaryNode<ItemType>* successorPtr = nullptr;
+		BinaryNode<ItemType>* revisedRightPtr = removeLeftmostNode(nodePtr->getRightChildPtr(), successorPtr);
+
+		successorPtr->setLeftChildPtr(nodePtr->getLeftChildPtr());
+		successorPtr->setRightChildPtr(revisedRightPtr);
+		successorPtr->updateHeightAndSize();
+		this->deallocateNode(nodePtr);
+		return successorPtr;
 	} // end if-else
 } // end removeNode
 
-template<class ItemType>
-BinaryNode<ItemType>* BinarySearchTree<ItemType>::removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
-	ItemType& inorderSuccessor)
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
+	BinaryNode<ItemType>*& successorPtr)
 {
-	if (nodePtr->getLeftChildPtr() == nullptr)
-	{
-		inorderSuccessor = nodePtr->getItem();
-		return removeNode(nodePtr);
-	}
-	else
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	BinaryNode<ItemType>* currentPtr = nodePtr;
+
+	while (currentPtr->getLeftChildPtr() != nullptr)
 	{
-		nodePtr->setLeftChildPtr(removeLeftmostNode(nodePtr->getLeftChildPtr(), inorderSuccessor));
-		return nodePtr;
-	} // end if-else   
+		path.push_back(currentPtr);
+		currentPtr = currentPtr->getLeftChildPtr();
+	} // end while
+
+	// The leftmost node has no left child, so its right child takes its place.
+	successorPtr = currentPtr;
+	BinaryNode<ItemType>* replacementPtr = currentPtr->getRightChildPtr();
+
+	if (path.size() == firstIndex)
+		return replacementPtr; // end if-else
+
+	path.back()->setLeftChildPtr(replacementPtr);
+	this->updatePath(firstIndex);
+	return nodePtr;
 } // end removeLeftmostNode
 
-template<class ItemType>
-BinaryNode<ItemType>* BinarySearchTree<ItemType>::findNode(BinaryNode<ItemType>* subTreePtr,
-	const ItemType& target) const
+template<class ItemType, class Compare>
+template<class LeftType, class RightType>
+bool BinarySearchTree<ItemType, Compare>::lessThan(const LeftType& left, const RightType& right) const
 {
-	// Uses a binary search.
-	if (subTreePtr == nullptr)	// The node was not found here.
-		return nullptr;
-	else if (subTreePtr->getItem() == target) // Found the node.
-		return subTreePtr;
-	else if (subTreePtr->getItem() > target)
-		// Search the left subtree.
-		return findNode(subTreePtr->getLeftChildPtr(), target);
+	this->getCounters().countComparison();
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+template<class Key>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::findNode(BinaryNode<ItemType>* subTreePtr,
+	const Key& target) const
+{
+	BinaryNode<ItemType>* candidatePtr = nullptr;	// Last node not less than the target.
+	int depth = 0;
+
+	// Uses a binary search with one comparison per level.
+	while (subTreePtr != nullptr)
+	{
+		++depth;
+		this->getCounters().countVisit();
+
+		if (lessThan(subTreePtr->getItem(), target))
+			// Search the right subtree.
+			subTreePtr = subTreePtr->getRightChildPtr();
+		else
+		{
+			// Search the left subtree for an earlier match.
+			candidatePtr = subTreePtr;
+			subTreePtr = subTreePtr->getLeftChildPtr();
+		} // end if-else
+	} // end while
+
+	this->getCounters().countLookup(depth);
+	if (candidatePtr == nullptr || lessThan(target, candidatePtr->getItem()))
+		return nullptr;	// The node was not found.
 	else
-		// Search the right subtree.
-		return findNode(subTreePtr->getRightChildPtr(), target);
+		return candidatePtr; // end if-else
 } // end findNode
 
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::getRootPtr() const
+{
+	return rootPtr;
+} // end getRootPtr
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::setRootPtr(BinaryNode<ItemType>* newRootPtr)
+{
+	rootPtr = newRootPtr;
+} // end setRootPtr
+
+template<class ItemType, class Compare>
+template<class Key>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::findEntryNode(const Key& aKey) const
+{
+	return findNode(rootPtr, aKey);
+} // end findEntryNode
+
+template<class ItemType, class Compare>
+template<class NodeAt>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::linkBalanced(const NodeAt& nodeAt, int first, int count)
+{
+	if (count == 0)
+		return nullptr; // end if-else
+
+	int leftCount = (count - 1) / 2;
+	BinaryNode<ItemType>* middlePtr = nodeAt(first + leftCount);
+
+	middlePtr->setLeftChildPtr(linkBalanced(nodeAt, first, leftCount));
+	middlePtr->setRightChildPtr(linkBalanced(nodeAt, first + leftCount + 1, count - 1 - leftCount));
+	middlePtr->updateHeightAndSize();
+	return middlePtr;
+} // end linkBalanced
+
+template<class ItemType, class Compare>
+template<class Key>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::findBoundNode(const Key& aKey,
+	bool isStrict) const
+{
+	BinaryNode<ItemType>* boundPtr = nullptr;
+	BinaryNode<ItemType>* currentPtr = rootPtr;
+
+	while (currentPtr != nullptr)
+	{
+		bool isBefore = isStrict ? !lessThan(aKey, currentPtr->getItem())
+			: lessThan(currentPtr->getItem(), aKey);
+
+		if (isBefore)
+			currentPtr = currentPtr->getRightChildPtr();
+		else
+		{
+			// This node is a candidate; look for an earlier one on the left.
+			boundPtr = currentPtr;
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end if-else
+	} // end while
+
+	return boundPtr;
+} // end findBoundNode
+
+template<class ItemType, class Compare>
+template<class RandomAccessIterator, class Report>
+void BinarySearchTree<ItemType, Compare>::searchBatch(RandomAccessIterator first,
+	RandomAccessIterator last, Report&& report) const
+{
+	// A descent in progress for one run of equivalent keys.
+	struct Descent
+	{
+		BinaryNode<ItemType>* currentPtr;	// Next node to compare the key with.
+		BinaryNode<ItemType>* candidatePtr;	// Last node not less than the key.
+		RandomAccessIterator keyPtr;		// The first key of the run.
+		std::size_t firstKey;				// Position in order of the first key of the run.
+		std::size_t lastKey;				// Position in order after the last key of the run.
+	};
+
+	// Sort the positions of the keys rather than the keys themselves, so
+	// the results can be reported in the original order.
+	std::size_t keyCount = static_cast<std::size_t>(last - first);
+	std::vector<std::size_t> order(keyCount);
+	for (std::size_t i = 0; i < keyCount; ++i)
+		order[i] = i; // end for
+	std::sort(order.begin(), order.end(), [this, first](std::size_t left, std::size_t right)
+	{
+		return lessThan(first[left], first[right]);
+	});
+
+	Descent descents[BATCH_WIDTH];
+	int activeCount = 0;
+	std::size_t nextKey = 0;	// Position in order of the next key to start.
+
+	auto startDescent = [&](Descent& descent)
+	{
+		descent.currentPtr = rootPtr;
+		descent.candidatePtr = nullptr;
+		descent.keyPtr = first + order[nextKey];
+		descent.firstKey = nextKey;
+
+		// Equivalent keys are adjacent after sorting and share the descent.
+		do
+			++nextKey;
+		while (nextKey < keyCount && !lessThan(*descent.keyPtr, first[order[nextKey]])); // end do-while
+		descent.lastKey = nextKey;
+	};
+
+	while (activeCount < BATCH_WIDTH && nextKey < keyCount)
+		startDescent(descents[activeCount++]); // end while
+
+	// Advance each active descent by one level in turn. A finished descent
+	// reports its run and is replaced by the next run, or by the last
+	// active descent once every run has been started.
+	while (activeCount > 0)
+	{
+		for (int i = 0; i < activeCount;)
+		{
+			Descent& descent = descents[i];
+
+			if (descent.currentPtr != nullptr)
+			{
+				if (lessThan(descent.currentPtr->getItem(), *descent.keyPtr))
+					descent.currentPtr = descent.currentPtr->getRightChildPtr();
+				else
+				{
+					descent.candidatePtr = descent.currentPtr;
+					descent.currentPtr = descent.currentPtr->getLeftChildPtr();
+				} // end if-else
+
+				prefetchForRead(descent.currentPtr);
+				++i;
+			}
+			else
+			{
+				BinaryNode<ItemType>* foundPtr = descent.candidatePtr;
+				if (foundPtr != nullptr && lessThan(*descent.keyPtr, foundPtr->getItem()))
+					foundPtr = nullptr; // end if-else
+
+				for (std::size_t k = descent.firstKey; k < descent.lastKey; ++k)
+					report(order[k], foundPtr); // end for
+
+				if (nextKey < keyCount)
+					startDescent(descent);
+				else
+					descent = descents[--activeCount]; // end if-else
+			} // end if-else
+		} // end for
+	} // end while
+} // end searchBatch
+
+// ---------------------------------------------------------------------------
+// Protected Split and Join Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::joinNodes(BinaryNode<ItemType>* leftPtr,
+	BinaryNode<ItemType>* middlePtr,
+	BinaryNode<ItemType>* rightPtr)
+{
+	middlePtr->setLeftChildPtr(leftPtr);
+	middlePtr->setRightChildPtr(rightPtr);
+	middlePtr->updateHeightAndSize();
+	return middlePtr;
+} // end joinNodes
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::concatNodes(BinaryNode<ItemType>* leftPtr,
+	BinaryNode<ItemType>* rightPtr)
+{
+	if (rightPtr == nullptr)
+		return leftPtr;
+	else if (leftPtr == nullptr)
+		return rightPtr; // end if-else
+
+	BinaryNode<ItemType>* middlePtr = nullptr;
+	BinaryNode<ItemType>* revisedRightPtr = removeLeftmostNode(rightPtr, middlePtr);
+	return joinNodes(leftPtr, middlePtr, revisedRightPtr);
+} // end concatNodes
+
+template<class ItemType, class Compare>
+template<class IsAfter>
+void BinarySearchTree<ItemType, Compare>::splitNodes(BinaryNode<ItemType>* subTreePtr, IsAfter&& isAfter,
+	BinaryNode<ItemType>*& lowerPtr, BinaryNode<ItemType>*& upperPtr)
+{
+	std::vector<BinaryNode<ItemType>*>& path = this->getPathBuffer();
+	std::size_t firstIndex = path.size();
+	bool isLastAfter = false;
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+
+	// A node after the split point sends the descent to its left.
+	while (currentPtr != nullptr)
+	{
+		path.push_back(currentPtr);
+		isLastAfter = isAfter(currentPtr);
+		currentPtr = isLastAfter ? currentPtr->getLeftChildPtr() : currentPtr->getRightChildPtr();
+	} // end while
+
+	// Going back up, each node takes the subtree on its far side of the path
+	// with it into one of the two parts. The side of every node but the
+	// deepest is told by which child the path went on to.
+	lowerPtr = nullptr;
+	upperPtr = nullptr;
+	BinaryNode<ItemType>* childPtr = nullptr;
+
+	while (path.size() > firstIndex)
+	{
+		BinaryNode<ItemType>* nodePtr = path.back();
+		path.pop_back();
+
+		bool isNodeAfter = (childPtr == nullptr) ? isLastAfter : nodePtr->getLeftChildPtr() == childPtr;
+		if (isNodeAfter)
+			upperPtr = joinNodes(upperPtr, nodePtr, nodePtr->getRightChildPtr());
+		else
+			lowerPtr = joinNodes(nodePtr->getLeftChildPtr(), nodePtr, lowerPtr); // end if-else
+
+		childPtr = nodePtr;
+	} // end while
+
+	if (lowerPtr != nullptr)
+		lowerPtr->setParentPtr(nullptr); // end if-else
+	if (upperPtr != nullptr)
+		upperPtr->setParentPtr(nullptr); // end if-else
+} // end splitNodes
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::splitByKey(BinaryNode<ItemType>* subTreePtr, const ItemType& aKey,
+	BinaryNode<ItemType>*& lessPtr, BinaryNode<ItemType>*& equalPtr,
+	BinaryNode<ItemType>*& greaterPtr)
+{
+	BinaryNode<ItemType>* notLessPtr = nullptr;
+
+	splitNodes(subTreePtr, [this, &aKey](BinaryNode<ItemType>* nodePtr)
+	{
+		return !lessThan(nodePtr->getItem(), aKey);
+	}, lessPtr, notLessPtr);
+
+	splitNodes(notLessPtr, [this, &aKey](BinaryNode<ItemType>* nodePtr)
+	{
+		return lessThan(aKey, nodePtr->getItem());
+	}, equalPtr, greaterPtr);
+} // end splitByKey
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::splitByRank(BinaryNode<ItemType>* subTreePtr, int count,
+	BinaryNode<ItemType>*& lowerPtr, BinaryNode<ItemType>*& upperPtr)
+{
+	splitNodes(subTreePtr, [this, &count](BinaryNode<ItemType>* nodePtr)
+	{
+		int leftSize = this->getNumberOfNodesHelper(nodePtr->getLeftChildPtr());
+		if (count <= leftSize)
+			return true; // end if-else
+
+		// This node and its left subtree are all before the split point.
+		count -= leftSize + 1;
+		return false;
+	}, lowerPtr, upperPtr);
+} // end splitByRank
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::mergeNodes(BinaryNode<ItemType>* firstPtr,
+	BinaryNode<ItemType>* secondPtr, bool keepsFirstOnly, bool keepsMatched, bool keepsSecondOnly)
+{
+	if (firstPtr == nullptr || secondPtr == nullptr)
+	{
+		if (firstPtr != nullptr && !keepsFirstOnly)
+		{
+			this->destroyTree(firstPtr);
+			firstPtr = nullptr;
+		} // end if-else
+
+		if (secondPtr != nullptr && !keepsSecondOnly)
+		{
+			this->destroyTree(secondPtr);
+			secondPtr = nullptr;
+		} // end if-else
+
+		return (firstPtr != nullptr) ? firstPtr : secondPtr;
+	} // end if-else
+
+	// Split both subtrees at the median of the smaller one, which halves it.
+	BinaryNode<ItemType>* pivotPtr = (firstPtr->getSize() <= secondPtr->getSize()) ? firstPtr : secondPtr;
+	int position = pivotPtr->getSize() / 2;
+	int leftSize = this->getNumberOfNodesHelper(pivotPtr->getLeftChildPtr());
+	while (position != leftSize)
+	{
+		if (position < leftSize)
+			pivotPtr = pivotPtr->getLeftChildPtr();
+		else
+		{
+			position -= leftSize + 1;
+			pivotPtr = pivotPtr->getRightChildPtr();
+		} // end if-else
+		leftSize = this->getNumberOfNodesHelper(pivotPtr->getLeftChildPtr());
+	} // end while
+
+	// The pivot node stays in one of the equal parts, so its item can be
+	// used as the key of both splits.
+	BinaryNode<ItemType>* firstLessPtr = nullptr;
+	BinaryNode<ItemType>* firstEqualPtr = nullptr;
+	BinaryNode<ItemType>* firstGreaterPtr = nullptr;
+	BinaryNode<ItemType>* secondLessPtr = nullptr;
+	BinaryNode<ItemType>* secondEqualPtr = nullptr;
+	BinaryNode<ItemType>* secondGreaterPtr = nullptr;
+	splitByKey(firstPtr, pivotPtr->getItem(), firstLessPtr, firstEqualPtr, firstGreaterPtr);
+	splitByKey(secondPtr, pivotPtr->getItem(), secondLessPtr, secondEqualPtr, secondGreaterPtr);
+
+	// Match the equivalent entries one to one, in order.
+	int matchCount = std::min(this->getNumberOfNodesHelper(firstEqualPtr),
+		this->getNumberOfNodesHelper(secondEqualPtr));
+	BinaryNode<ItemType>* firstMatchedPtr = nullptr;
+	BinaryNode<ItemType>* firstUnmatchedPtr = nullptr;
+	BinaryNode<ItemType>* secondMatchedPtr = nullptr;
+	BinaryNode<ItemType>* secondUnmatchedPtr = nullptr;
+	splitByRank(firstEqualPtr, matchCount, firstMatchedPtr, firstUnmatchedPtr);
+	splitByRank(secondEqualPtr, matchCount, secondMatchedPtr, secondUnmatchedPtr);
+
+	this->destroyTree(secondMatchedPtr);
+	if (!keepsMatched)
+	{
+		this->destroyTree(firstMatchedPtr);
+		firstMatchedPtr = nullptr;
+	} // end if-else
+
+	if (!keepsFirstOnly)
+	{
+		this->destroyTree(firstUnmatchedPtr);
+		firstUnmatchedPtr = nullptr;
+	} // end if-else
+
+	if (!keepsSecondOnly)
+	{
+		this->destroyTree(secondUnmatchedPtr);
+		secondUnmatchedPtr = nullptr;
+	} // end if-else
+
+	BinaryNode<ItemType>* equalPtr = concatNodes(concatNodes(firstMatchedPtr, firstUnmatchedPtr),
+		secondUnmatchedPtr);
+
+	BinaryNode<ItemType>* lessPtr = mergeNodes(firstLessPtr, secondLessPtr,
+		keepsFirstOnly, keepsMatched, keepsSecondOnly);
+	BinaryNode<ItemType>* greaterPtr = mergeNodes(firstGreaterPtr, secondGreaterPtr,
+		keepsFirstOnly, keepsMatched, keepsSecondOnly);
+	return concatNodes(concatNodes(lessPtr, equalPtr), greaterPtr);
+} // end mergeNodes
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::splitInto(const ItemType& aKey,
+	BinarySearchTree<ItemType, Compare>& upperTree)
+{
+	BinaryNode<ItemType>* lowerPtr = nullptr;
+	BinaryNode<ItemType>* upperPtr = nullptr;
+
+	splitNodes(rootPtr, [this, &aKey](BinaryNode<ItemType>* nodePtr)
+	{
+		return !lessThan(nodePtr->getItem(), aKey);
+	}, lowerPtr, upperPtr);
+
+	rootPtr = lowerPtr;
+	upperTree.takeNodesFrom(*this, this->getNumberOfNodesHelper(upperPtr));
+	upperTree.rootPtr = upperPtr;
+} // end splitInto
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* BinarySearchTree<ItemType, Compare>::takeRootFrom(BinarySearchTree<ItemType, Compare>& otherTree)
+{
+	BinaryNode<ItemType>* otherRootPtr = otherTree.rootPtr;
+
+	this->takeNodesFrom(otherTree, this->getNumberOfNodesHelper(otherRootPtr));
+	otherTree.rootPtr = nullptr;
+	otherTree.clear();	// Drops its share of the slabs.
+	return otherRootPtr;
+} // end takeRootFrom
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::mergeWith(BinarySearchTree<ItemType, Compare>& otherTree,
+	bool keepsFirstOnly, bool keepsMatched, bool keepsSecondOnly)
+{
+	if (&otherTree == this)
+		throw PreconditionException("A set operation was called with a tree and itself."); // end if-else
+
+	BinaryNode<ItemType>* otherRootPtr = takeRootFrom(otherTree);
+	rootPtr = mergeNodes(rootPtr, otherRootPtr, keepsFirstOnly, keepsMatched, keepsSecondOnly);
+	if (rootPtr != nullptr)
+		rootPtr->setParentPtr(nullptr); // end if-else
+} // end mergeWith
+
 // ---------------------------------------------------------------------------
 // Constructor and Destructor Section.
 // ---------------------------------------------------------------------------
 
-template<class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree() : rootPtr(nullptr)
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree() : rootPtr(nullptr), comparator()
 {
 } // end default constructor
 
-template<class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree(const ItemType& rootItem)
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree(const Compare& treeComparator)
+	: rootPtr(nullptr), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree(const ItemType& rootItem) : comparator()
 {
-	rootPtr = new BinaryNode<ItemType>(rootItem, nullptr, nullptr);
+	rootPtr = this->allocateNode(rootItem);
 } // end parameterized constructor
 
-template<class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree(const BinarySearchTree<ItemType>& treePtr)
+template<class ItemType, class Compare>
+template<class InputIterator>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree(InputIterator first, InputIterator last,
+	const Compare& treeComparator) : rootPtr(nullptr), comparator(treeComparator)
+{
+	assign(first, last);
+} // end range constructor
+
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree(const BinarySearchTree<ItemType, Compare>& treePtr)
+	: BinaryNodeTree<ItemType>(), rootPtr(nullptr), comparator(treePtr.comparator)
 {
 	rootPtr = this->copyTree(treePtr.rootPtr);
 } // end parameterized copy constructor
 
-template<class ItemType>
-BinarySearchTree<ItemType>::~BinarySearchTree()
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::BinarySearchTree(BinarySearchTree<ItemType, Compare>&& tree)
+	: BinaryNodeTree<ItemType>(std::move(tree)), rootPtr(tree.rootPtr), comparator(std::move(tree.comparator))
 {
-	this->destroyTree(rootPtr);
+	tree.rootPtr = nullptr;
+} // end move constructor
+
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>::~BinarySearchTree()
+{
+	this->destroyAllNodes(rootPtr);
 } // end destructor
 
 // ---------------------------------------------------------------------------
 // Public BinaryTreeInterface Methods Section.
 // ---------------------------------------------------------------------------
 
-template<class ItemType>
-bool BinarySearchTree<ItemType>::isEmpty() const
+template<class ItemType, class Compare>
+bool BinarySearchTree<ItemType, Compare>::isEmpty() const
 {
 	return rootPtr == nullptr;
 } // end isEmpty
 
-template<class ItemType>
-int BinarySearchTree<ItemType>::getHeight() const
+template<class ItemType, class Compare>
+int BinarySearchTree<ItemType, Compare>::getHeight() const
 {
 	return this->getHeightHelper(rootPtr);
 } // end getHeight
 
-template<class ItemType>
-int BinarySearchTree<ItemType>::getNumberOfNodes() const
+template<class ItemType, class Compare>
+int BinarySearchTree<ItemType, Compare>::getNumberOfNodes() const
 {
 	return this->getNumberOfNodesHelper(rootPtr);
 } // end getNumberOfNodes
 
-template<class ItemType>
-void BinarySearchTree<ItemType>::clear()
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::clear()
 {
-	this->destroyTree(rootPtr);
+	this->destroyAllNodes(rootPtr);
 	rootPtr = nullptr;
 } // end clear
 
-template<class ItemType>
-ItemType BinarySearchTree<ItemType>::getRootData() const throw(PreconditionException)
+template<class ItemType, class Compare>
+const ItemType& BinarySearchTree<ItemType, Compare>::getRootData() const
 {
 	if (isEmpty())
 		throw PreconditionException("Function getRootData() was called with an empty tree."); // end if-else
@@ -194,30 +686,57 @@ ItemType BinarySearchTree<ItemType>::getRootData() const throw(PreconditionExcep
 	return rootPtr->getItem();
 } // end getRootData
 
-template<class ItemType>
-void BinarySearchTree<ItemType>::setRootData(const ItemType& newItem) const throw(PreconditionException)
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::setRootData(const ItemType& newItem) const
 {
 	throw PreconditionException("The root data in a binary search tree cannot be changed.");
 } // end setRootData
 
-template<class ItemType>
-bool BinarySearchTree<ItemType>::add(const ItemType& newData)
+template<class ItemType, class Compare>
+bool BinarySearchTree<ItemType, Compare>::add(const ItemType& newData)
+{
+	BinaryNode<ItemType>* newNodePtr = this->allocateNode(newData);
+	rootPtr = insertInorder(rootPtr, newNodePtr);
+	rootPtr->setParentPtr(nullptr);	// A rotation may have replaced the root.
+	this->getCounters().countInsertion();
+	return true;
+} // end add
+
+template<class ItemType, class Compare>
+bool BinarySearchTree<ItemType, Compare>::add(ItemType&& newData)
 {
-	BinaryNode<ItemType>* newNodePtr = new BinaryNode<ItemType>(newData);
+	BinaryNode<ItemType>* newNodePtr = this->allocateNode(std::move(newData));
 	rootPtr = insertInorder(rootPtr, newNodePtr);
+	rootPtr->setParentPtr(nullptr);	// A rotation may have replaced the root.
+	this->getCounters().countInsertion();
 	return true;
 } // end add
 
-template<class ItemType>
-bool BinarySearchTree<ItemType>::remove(const ItemType& target)
+template<class ItemType, class Compare>
+template<class... Args>
+bool BinarySearchTree<ItemType, Compare>::emplace(Args&&... args)
+{
+	BinaryNode<ItemType>* newNodePtr = this->allocateNode(std::piecewise_construct,
+		std::forward<Args>(args)...);
+	rootPtr = insertInorder(rootPtr, newNodePtr);
+	rootPtr->setParentPtr(nullptr);	// A rotation may have replaced the root.
+	this->getCounters().countInsertion();
+	return true;
+} // end emplace
+
+template<class ItemType, class Compare>
+bool BinarySearchTree<ItemType, Compare>::remove(const ItemType& target)
 {
 	bool isSuccessful = false;
 	rootPtr = removeValue(rootPtr, target, isSuccessful);
+	if (rootPtr != nullptr)	// The removal or a rotation may have replaced the root.
+		rootPtr->setParentPtr(nullptr); // end if-else
+	this->getCounters().countRemoval();
 	return isSuccessful;
 } // end remove
 
-template<class ItemType>
-ItemType BinarySearchTree<ItemType>::getEntry(const ItemType& anEntry) const throw(NotFoundException)
+template<class ItemType, class Compare>
+const ItemType& BinarySearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
 {
 	BinaryNode<ItemType>* nodeWithEntry = findNode(rootPtr, anEntry);
 
@@ -227,46 +746,540 @@ ItemType BinarySearchTree<ItemType>::getEntry(const ItemType& anEntry) const thr
 		return nodeWithEntry->getItem(); // end if-else
 } // end getEntry
 
-template<class ItemType>
-bool BinarySearchTree<ItemType>::contains(const ItemType& anEntry) const
+template<class ItemType, class Compare>
+bool BinarySearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
 {
 	return (findNode(rootPtr, anEntry) != nullptr) ? true : false;  // nullptr is the same as false.
 } // end contains
 
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+const ItemType& BinarySearchTree<ItemType, Compare>::getEntry(const Key& aKey) const
+{
+	BinaryNode<ItemType>* nodeWithEntry = findNode(rootPtr, aKey);
+
+	if (nodeWithEntry == nullptr)
+		throw NotFoundException("The entry does not exist within the binary search tree.");
+	else
+		return nodeWithEntry->getItem(); // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+bool BinarySearchTree<ItemType, Compare>::contains(const Key& aKey) const
+{
+	return findNode(rootPtr, aKey) != nullptr;
+} // end contains
+
+template<class ItemType, class Compare>
+Compare BinarySearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Batch Lookup Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class RandomAccessIterator, class ResultIterator>
+void BinarySearchTree<ItemType, Compare>::containsBatch(RandomAccessIterator first,
+	RandomAccessIterator last, ResultIterator results) const
+{
+	searchBatch(first, last, [&results](std::size_t position, const BinaryNode<ItemType>* nodePtr)
+	{
+		results[position] = (nodePtr != nullptr);
+	});
+} // end containsBatch
+
+template<class ItemType, class Compare>
+template<class RandomAccessIterator, class ResultIterator>
+void BinarySearchTree<ItemType, Compare>::findBatch(RandomAccessIterator first,
+	RandomAccessIterator last, ResultIterator results) const
+{
+	searchBatch(first, last, [&results](std::size_t position, const BinaryNode<ItemType>* nodePtr)
+	{
+		results[position] = (nodePtr != nullptr) ? &nodePtr->getItem() : nullptr;
+	});
+} // end findBatch
+
+// ---------------------------------------------------------------------------
+// Public Order Statistics Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+const ItemType& BinarySearchTree<ItemType, Compare>::select(int position) const
+{
+	if (position < 0 || position >= getNumberOfNodes())
+		throw PreconditionException("Function select() was called with a position out of range."); // end if-else
+
+	BinaryNode<ItemType>* currentPtr = rootPtr;
+	while (true)
+	{
+		int leftSize = this->getNumberOfNodesHelper(currentPtr->getLeftChildPtr());
+
+		if (position < leftSize)
+			currentPtr = currentPtr->getLeftChildPtr();
+		else if (position == leftSize)
+			return currentPtr->getItem();
+		else
+		{
+			// Skip the left subtree and this node.
+			position -= leftSize + 1;
+			currentPtr = currentPtr->getRightChildPtr();
+		} // end if-else
+	} // end while
+} // end select
+
+template<class ItemType, class Compare>
+int BinarySearchTree<ItemType, Compare>::rank(const ItemType& anEntry) const
+{
+	int entriesBefore = 0;
+	BinaryNode<ItemType>* currentPtr = rootPtr;
+
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(currentPtr->getItem(), anEntry))
+		{
+			// This node and its whole left subtree come before anEntry.
+			entriesBefore += this->getNumberOfNodesHelper(currentPtr->getLeftChildPtr()) + 1;
+			currentPtr = currentPtr->getRightChildPtr();
+		}
+		else
+			currentPtr = currentPtr->getLeftChildPtr(); // end if-else
+	} // end while
+
+	return entriesBefore;
+} // end rank
+
+// ---------------------------------------------------------------------------
+// Public Range Queries Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::iterator
+BinarySearchTree<ItemType, Compare>::lowerBound(const ItemType& anEntry) const
+{
+	return iterator(findBoundNode(anEntry, false), rootPtr);
+} // end lowerBound
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::iterator
+BinarySearchTree<ItemType, Compare>::upperBound(const ItemType& anEntry) const
+{
+	return iterator(findBoundNode(anEntry, true), rootPtr);
+} // end upperBound
+
+template<class ItemType, class Compare>
+std::pair<typename BinarySearchTree<ItemType, Compare>::iterator,
+	typename BinarySearchTree<ItemType, Compare>::iterator>
+BinarySearchTree<ItemType, Compare>::equalRange(const ItemType& anEntry) const
+{
+	return std::make_pair(lowerBound(anEntry), upperBound(anEntry));
+} // end equalRange
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BinarySearchTree<ItemType, Compare>::forEachInRange(const ItemType& low, const ItemType& high,
+	Visitor&& visit) const
+{
+	std::vector<const BinaryNode<ItemType>*> nodeStack;
+	if (rootPtr != nullptr)
+		nodeStack.reserve(rootPtr->getHeight()); // end if-else
+
+	// Push the path to the first entry in the range. Only the nodes that are
+	// not less than low are pushed; the others and their left subtrees are
+	// skipped.
+	const BinaryNode<ItemType>* currentPtr = rootPtr;
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(currentPtr->getItem(), low))
+			currentPtr = currentPtr->getRightChildPtr();
+		else
+		{
+			nodeStack.push_back(currentPtr);
+			currentPtr = currentPtr->getLeftChildPtr();
+		} // end if-else
+	} // end while
+
+	// Continue inorder until an entry is not less than high.
+	while (!nodeStack.empty())
+	{
+		currentPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		if (!lessThan(currentPtr->getItem(), high))
+			return true; // end if-else
+		if (!applyVisitor(visit, currentPtr->getItem()))
+			return false; // end if-else
+
+		for (currentPtr = currentPtr->getRightChildPtr(); currentPtr != nullptr;
+			currentPtr = currentPtr->getLeftChildPtr())
+			nodeStack.push_back(currentPtr); // end for
+	} // end while
+
+	return true;
+} // end forEachInRange
+
+// ---------------------------------------------------------------------------
+// Public Bulk Loading Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class ForwardIterator>
+void BinarySearchTree<ItemType, Compare>::assignSorted(ForwardIterator first, ForwardIterator last)
+{
+	int count = static_cast<int>(std::distance(first, last));
+
+	clear();
+	if (count == 0)
+		return; // end if-else
+
+	// Construct the nodes in inorder in one block, and destroy the ones
+	// already built if copying an entry throws.
+	BinaryNode<ItemType>* blockPtr = this->allocateNodeBlock(count);
+	int constructedCount = 0;
+
+	try
+	{
+		for (; constructedCount < count; ++first)
+		{
+			new (blockPtr + constructedCount) BinaryNode<ItemType>(*first);
+			++constructedCount;
+		} // end for
+	}
+	catch (...)
+	{
+		this->releaseNodeBlock(blockPtr, constructedCount, count);
+		throw;
+	} // end try-catch
+
+	rootPtr = linkBalanced([blockPtr](int index) { return blockPtr + index; }, 0, count);
+} // end assignSorted
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+void BinarySearchTree<ItemType, Compare>::assign(InputIterator first, InputIterator last)
+{
+	std::vector<ItemType> entries(first, last);
+
+	if (!std::is_sorted(entries.begin(), entries.end(), comparator))
+		std::sort(entries.begin(), entries.end(), comparator); // end if-else
+
+	assignSorted(std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+} // end assign
+
+// ---------------------------------------------------------------------------
+// Public Persistence Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::save(std::ostream& output) const
+{
+	BinaryWriter writer(output);
+	writer.writeHeader(TreeFileFormat::SORTED_ENTRIES, ItemCodec<ItemType>::TAG, getNumberOfNodes());
+
+	inorderTraverse([&writer](const ItemType& anEntry)
+	{
+		ItemCodec<ItemType>::write(writer, anEntry);
+	});
+	writer.flush();
+} // end save
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::save(const std::string& fileName) const
+{
+	std::ofstream file(fileName, std::ios_base::binary | std::ios_base::trunc);
+	if (!file)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	save(file);
+} // end save
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::load(std::istream& input)
+{
+	clear();
+
+	BinaryReader reader(input);
+	int count = reader.readHeader(TreeFileFormat::SORTED_ENTRIES, ItemCodec<ItemType>::TAG);
+	if (count > 0)
+	{
+		std::vector<BinaryNode<ItemType>*> blocks;
+		int constructedCount = 0;
+
+		try
+		{
+			BinaryNode<ItemType>* previousPtr = nullptr;
+			for (int i = 0; i < count; ++i)
+			{
+				BinaryNode<ItemType>* nodePtr = new (this->allocateLoadedNode(blocks, i, count))
+					BinaryNode<ItemType>(ItemCodec<ItemType>::read(reader));
+				++constructedCount;
+
+				if (previousPtr != nullptr && lessThan(nodePtr->getItem(), previousPtr->getItem()))
+					throw SerializationException("The stream holds entries out of order."); // end if-else
+				previousPtr = nodePtr;
+			} // end for
+		}
+		catch (const std::bad_alloc&)
+		{
+			this->releaseLoadedNodes(blocks, constructedCount, count);
+			throw SerializationException("The tree does not fit in memory.");
+		}
+		catch (...)
+		{
+			this->releaseLoadedNodes(blocks, constructedCount, count);
+			throw;
+		} // end try-catch
+
+		rootPtr = linkBalanced([&blocks](int index) { return BinaryNodeTree<ItemType>::getLoadedNode(blocks, index); },
+			0, count);
+	} // end if-else
+
+	reader.finish();
+} // end load
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::load(const std::string& fileName)
+{
+	std::ifstream file(fileName, std::ios_base::binary);
+	if (!file)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	load(file);
+} // end load
+
+// ---------------------------------------------------------------------------
+// Public Split and Join Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare> BinarySearchTree<ItemType, Compare>::split(const ItemType& aKey)
+{
+	BinarySearchTree<ItemType, Compare> upperTree(comparator);
+	splitInto(aKey, upperTree);
+	return upperTree;
+} // end split
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::join(const ItemType& aKey,
+	BinarySearchTree<ItemType, Compare>& greaterTree)
+{
+	if (&greaterTree == this)
+		throw PreconditionException("Function join() was called with a tree and itself."); // end if-else
+
+	if ((rootPtr != nullptr && lessThan(aKey, *rbegin()))
+		|| (greaterTree.rootPtr != nullptr && lessThan(*greaterTree.begin(), aKey)))
+		throw PreconditionException("Function join() was called with entries out of order."); // end if-else
+
+	BinaryNode<ItemType>* middlePtr = this->allocateNode(aKey);
+	BinaryNode<ItemType>* rightPtr = takeRootFrom(greaterTree);
+	rootPtr = joinNodes(rootPtr, middlePtr, rightPtr);
+	rootPtr->setParentPtr(nullptr);
+} // end join
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::concat(BinarySearchTree<ItemType, Compare>& greaterTree)
+{
+	if (&greaterTree == this)
+		throw PreconditionException("Function concat() was called with a tree and itself."); // end if-else
+
+	if (rootPtr != nullptr && greaterTree.rootPtr != nullptr && lessThan(*greaterTree.begin(), *rbegin()))
+		throw PreconditionException("Function concat() was called with entries out of order."); // end if-else
+
+	BinaryNode<ItemType>* rightPtr = takeRootFrom(greaterTree);
+	rootPtr = concatNodes(rootPtr, rightPtr);
+	if (rootPtr != nullptr)
+		rootPtr->setParentPtr(nullptr); // end if-else
+} // end concat
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::unionWith(BinarySearchTree<ItemType, Compare>& otherTree)
+{
+	mergeWith(otherTree, true, true, true);
+} // end unionWith
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::intersectWith(BinarySearchTree<ItemType, Compare>& otherTree)
+{
+	mergeWith(otherTree, false, true, false);
+} // end intersectWith
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::differenceWith(BinarySearchTree<ItemType, Compare>& otherTree)
+{
+	mergeWith(otherTree, true, false, false);
+} // end differenceWith
+
+// ---------------------------------------------------------------------------
+// Public Snapshot Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+FrozenSearchTree<ItemType, Compare> BinarySearchTree<ItemType, Compare>::freeze() const
+{
+	FrozenSearchTree<ItemType, Compare> snapshot(comparator);
+	freeze(snapshot);
+	return snapshot;
+} // end freeze
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::freeze(FrozenSearchTree<ItemType, Compare>& snapshot) const
+{
+	snapshot.comparator = comparator;
+	if (rootPtr == nullptr)
+	{
+		snapshot.entries.clear();
+		snapshot.entryCount = 0;
+		return;
+	} // end if-else
+
+	std::size_t count = static_cast<std::size_t>(rootPtr->getSize());
+	snapshot.prepare(count, rootPtr->getItem());
+
+	// Visiting the indexes in inorder pairs them with the entries in
+	// ascending order.
+	std::size_t index = EytzingerIterator<ItemType>::firstIndex(count);
+	auto storeEntry = [&snapshot, &index, count](const ItemType& anEntry)
+	{
+		snapshot.entries[index] = anEntry;
+		index = EytzingerIterator<ItemType>::nextIndex(index, count);
+	};
+	this->inorderVisit(storeEntry, rootPtr);
+} // end freeze
+
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::saveImage(const std::string& fileName) const
+{
+	MappedSearchTree<ItemType, Compare>::writeEntries(fileName, begin(),
+		static_cast<std::size_t>(getNumberOfNodes()));
+} // end saveImage
+
 // ---------------------------------------------------------------------------
 // Public Traversals Section.
 // See @file BinaryTreeInterface.h for documentation.
 // ---------------------------------------------------------------------------
 
-template<class ItemType>
-void BinarySearchTree<ItemType>::preorderTraverse(void visit(ItemType&)) const
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::preorderTraverse(void visit(ItemType&)) const
 {
 	this->preorder(visit, rootPtr);
 } // end preorderTraverse
 
-template<class ItemType>
-void BinarySearchTree<ItemType>::inorderTraverse(void visit(ItemType&)) const
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::inorderTraverse(void visit(ItemType&)) const
 {
 	this->inorder(visit, rootPtr);
 } // end inorderTraverse
 
-template<class ItemType>
-void BinarySearchTree<ItemType>::postorderTraverse(void visit(ItemType&)) const
+template<class ItemType, class Compare>
+void BinarySearchTree<ItemType, Compare>::postorderTraverse(void visit(ItemType&)) const
 {
 	this->postorder(visit, rootPtr);
 } // end postorderTraverse
 
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BinarySearchTree<ItemType, Compare>::preorderTraverse(Visitor&& visit) const
+{
+	return this->preorderVisit(visit, rootPtr);
+} // end preorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BinarySearchTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	return this->inorderVisit(visit, rootPtr);
+} // end inorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool BinarySearchTree<ItemType, Compare>::postorderTraverse(Visitor&& visit) const
+{
+	return this->postorderVisit(visit, rootPtr);
+} // end postorderTraverse
+
+// ---------------------------------------------------------------------------
+// Public Parallel Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class Visitor>
+void BinarySearchTree<ItemType, Compare>::parallelForEach(Visitor&& visit) const
+{
+	this->parallelForEachHelper(visit, rootPtr);
+} // end parallelForEach
+
+template<class ItemType, class Compare>
+template<class Map, class Combine>
+typename BinaryNodeTree<ItemType>::template ReduceResult<Map> BinarySearchTree<ItemType, Compare>::parallelReduce(
+	Map&& map, Combine&& combine) const
+{
+	if (rootPtr == nullptr)
+		return typename BinaryNodeTree<ItemType>::template ReduceResult<Map>(); // end if-else
+
+	return this->parallelReduceHelper(map, combine, rootPtr);
+} // end parallelReduce
+
+// ---------------------------------------------------------------------------
+// Public Iterators Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::iterator BinarySearchTree<ItemType, Compare>::begin() const
+{
+	return iterator(iterator::leftmost(rootPtr), rootPtr);
+} // end begin
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::iterator BinarySearchTree<ItemType, Compare>::end() const
+{
+	return iterator(nullptr, rootPtr);
+} // end end
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::reverse_iterator BinarySearchTree<ItemType, Compare>::rbegin() const
+{
+	return reverse_iterator(end());
+} // end rbegin
+
+template<class ItemType, class Compare>
+typename BinarySearchTree<ItemType, Compare>::reverse_iterator BinarySearchTree<ItemType, Compare>::rend() const
+{
+	return reverse_iterator(begin());
+} // end rend
+
 // ---------------------------------------------------------------------------
 // Overloaded Operator Section.
 // ---------------------------------------------------------------------------
 
-template<class ItemType>
-BinarySearchTree<ItemType>& BinarySearchTree<ItemType>::
-operator=(const BinarySearchTree<ItemType>& rightHandSide)
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>& BinarySearchTree<ItemType, Compare>::
+operator=(const BinarySearchTree<ItemType, Compare>& rightHandSide)
 {
-	if (!isEmpty())
+	if (this != &rightHandSide)
+	{
 		clear();
-	this = copyTree(&rightHandSide);
+		rootPtr = this->copyTree(rightHandSide.rootPtr);
+		comparator = rightHandSide.comparator;
+	} // end if-else
+
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+BinarySearchTree<ItemType, Compare>& BinarySearchTree<ItemType, Compare>::
+operator=(BinarySearchTree<ItemType, Compare>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		clear();
+		BinaryNodeTree<ItemType>::operator=(std::move(rightHandSide));
+		rootPtr = rightHandSide.rootPtr;
+		comparator = std::move(rightHandSide.comparator);
+		rightHandSide.rootPtr = nullptr;
+	} // end if-else
 
 	return *this;
 } // end operator=
@@ -1,6 +1,8 @@
 /**
 This templated class provides methods for creating and performing
-operations on a binary search tree (BST).
+operations on a binary search tree (BST). The entries are ordered by
+Compare, a strict weak ordering that defaults to std::less, and every
+search makes a single comparison per level.
 
 @author		Solomon Colley
 @file		BinarySearchTree.h
@@ -9,17 +11,34 @@ operations on a binary search tree (BST).
  
 #pragma once
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
 #include "BinaryTreeInterface.h"
 #include "BinaryNode.h"
 #include "BinaryNodeTree.h"
+#include "BinaryTreeIterator.h"
+#include "FrozenSearchTree.h"
+#include "MappedSearchTree.h"
 #include "NotFoundException.h"
 #include "PreconditionException.h"
+#include "Prefetch.h"
+#include "TreeSerialization.h"
 
-template<class ItemType>
+template<class ItemType, class Compare = std::less<ItemType>>
 class BinarySearchTree : public BinaryNodeTree<ItemType>
 {
 private:
    BinaryNode<ItemType>* rootPtr;	// Pointer to the root of a tree.
+   Compare comparator;				// Strict weak ordering of the entries.
+
+   static const int BATCH_WIDTH = 16;	// Descents interleaved by a batched lookup.
    
 protected:
 	// ---------------------------------------------------------------------------
@@ -27,8 +46,8 @@ protected:
 	// ---------------------------------------------------------------------------
 
 	/**
-	Recursively finds where the argument as a given node should be
-	placed in the tree and inserts it in a leaf node at that position.
+	Finds where the argument as a given node should be placed in the
+	tree and inserts it in a leaf node at that position.
 	@post		The new node was inserted at the correct position in
 					the tree.
 	@param		BinaryNode<ItemType>* subTreePtr
@@ -36,27 +55,28 @@ protected:
 	@return		A pointer to the revised subtree, or nullptr if
 					subTreePtr was nullptr.
 	*/
-	BinaryNode<ItemType>* insertInorder(BinaryNode<ItemType>* subTreePtr,
-                                       BinaryNode<ItemType>* newNode);
+	virtual BinaryNode<ItemType>* insertInorder(BinaryNode<ItemType>* subTreePtr,
+                                               BinaryNode<ItemType>* newNode);
    
 	/**
-	Recursive function for removing the argument as a given target
-	from the tree while maintaining a binary search tree structure.
+	Function for removing the argument as a given target from the
+	tree while maintaining a binary search tree structure.
 	@post		The given target is removed from the tree.
 	@param		BinaryNode<ItemType>* subTreePtr
-	@param		const ItemType target
+	@param		const ItemType& target
 	@param		bool& success
 	@return		A pointer to the revised subtree, or nullptr if
 					subTreePtr was nullptr.
 	*/
-	BinaryNode<ItemType>* removeValue(BinaryNode<ItemType>* subTreePtr,
-                                     const ItemType target,
-                                     bool& success);
+	virtual BinaryNode<ItemType>* removeValue(BinaryNode<ItemType>* subTreePtr,
+                                             const ItemType& target,
+                                             bool& success);
 
 	/**
-	Recursive function for removing the argument as a given node
-	pointer from the tree while maintaining a binary search tree
-	structure.
+	Function for removing the argument as a given node pointer from
+	the tree while maintaining a binary search tree structure. A node
+	with two children is replaced by its inorder successor node, which is
+	relinked rather than having its data item copied.
 	@post		The given node is removed from the tree.
 	@param		BinaryNode<ItemType>* nodePtr
 	@return		A pointer to the node.
@@ -64,38 +84,259 @@ protected:
 	BinaryNode<ItemType>* removeNode(BinaryNode<ItemType>* nodePtr);
 
 	/**
-	Recursive function for removing the leftmost node in the left
-	subtree of the node pointed to by nodePtr. Sets inorderSuccessor
-	to the value in this node and returns a pointer to the revised
-	subtree.
-	@post		The leftmost node has been removed.
+	Function for detaching the leftmost node in the subtree of the
+	node pointed to by nodePtr. Sets successorPtr to the detached node,
+	which is not deleted, and returns a pointer to the revised subtree.
+	@post		The leftmost node has been unlinked from the subtree.
 	@param		BinaryNode<ItemType>* nodePtr
-	@param		ItemType& inorderSuccessor
+	@param		BinaryNode<ItemType>*& successorPtr
 	@return		A pointer to the revised subtree.
 	*/
-	BinaryNode<ItemType>* removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
-                                            ItemType& inorderSuccessor);
+	virtual BinaryNode<ItemType>* removeLeftmostNode(BinaryNode<ItemType>* nodePtr,
+                                                    BinaryNode<ItemType>*& successorPtr);
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree. Either argument may be a key type that the comparator
+	accepts in place of ItemType.
+	@param		const LeftType& left
+	@param		const RightType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	template<class LeftType, class RightType>
+	bool lessThan(const LeftType& left, const RightType& right) const;
 
 	/**
-	Recursive function for returning a pointer to the node containing
-	the given target value, or nullptr if the target value was
-	not found in the tree.
+	Function for returning a pointer to the node containing the
+	given target value, or nullptr if the target value was not
+	found in the tree. The search descends with one comparison per
+	level, remembering the last node that is not less than the target,
+	and checks for equality once at the bottom.
 	@param		BinaryNode<ItemType>* treePtr
-	@param		const ItemType& target
-	@return		A pointer to the node containing the target, or
-					nullptr if it was not found.
+	@param		const Key& target
+	@return		A pointer to the first node in inorder containing the
+					target, or nullptr if it was not found.
 	*/
+	template<class Key>
 	BinaryNode<ItemType>* findNode(BinaryNode<ItemType>* treePtr,
-                                  const ItemType& target) const;
+                                  const Key& target) const;
+
+	/**
+	Returns or replaces the root of this tree, for subclasses that
+	restructure the tree themselves.
+	@param		BinaryNode<ItemType>* newRootPtr
+	@return		The root, or nullptr if the tree is empty.
+	*/
+	BinaryNode<ItemType>* getRootPtr() const;
+	void setRootPtr(BinaryNode<ItemType>* newRootPtr);
+
+	/**
+	Returns the node holding the first entry equivalent to aKey, searching
+	from the root of this tree as findNode does.
+	@param		const Key& aKey
+	@return		A pointer to the node, or nullptr if aKey was not found.
+	*/
+	template<class Key>
+	BinaryNode<ItemType>* findEntryNode(const Key& aKey) const;
+
+	/**
+	Links the count nodes nodeAt(first) to nodeAt(first + count - 1),
+	which are in inorder, into a perfectly balanced subtree, whose root is
+	the middle node and whose halves are linked the same way. The
+	recursion is only log2(count) levels deep.
+	@pre		The nodes are constructed and not linked.
+	@param		const NodeAt& nodeAt maps an index to a node pointer.
+	@param		int first
+	@param		int count
+	@return		A pointer to the root of the subtree, or nullptr if count
+					is 0.
+	*/
+	template<class NodeAt>
+	BinaryNode<ItemType>* linkBalanced(const NodeAt& nodeAt, int first, int count);
+
+	/**
+	Returns the first node in inorder whose entry is not less than aKey,
+	or greater than aKey when isStrict is true, using one comparison per
+	level.
+	@param		const Key& aKey
+	@param		bool isStrict
+	@return		A pointer to the node, or nullptr if every entry is
+					ordered before it.
+	*/
+	template<class Key>
+	BinaryNode<ItemType>* findBoundNode(const Key& aKey, bool isStrict) const;
+
+	/**
+	Looks up every key in the range [first, last) and calls
+	report(i, nodePtr) once for each key, where i is the position of the
+	key in the range and nodePtr is the node that findNode would return
+	for it. The keys are searched in ascending order, equivalent keys
+	share a single descent, and up to BATCH_WIDTH descents are advanced
+	in turn with the next node of each prefetched, so that their cache
+	misses overlap instead of following one another.
+	@param		RandomAccessIterator first
+	@param		RandomAccessIterator last
+	@param		Report&& report
+	@return		void
+	*/
+	template<class RandomAccessIterator, class Report>
+	void searchBatch(RandomAccessIterator first, RandomAccessIterator last, Report&& report) const;
+
+	// ---------------------------------------------------------------------------
+	// Protected Split and Join Methods Section.
+	// These relink the nodes they are given and never copy or allocate one.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Joins two subtrees and a node that goes between them into one subtree.
+	The node simply becomes the root of the two subtrees, which takes O(1).
+	@pre		Every entry of leftPtr is not greater than the entry of
+					middlePtr, which is not greater than any entry of
+					rightPtr. middlePtr is not linked into any subtree.
+	@post		The heights and sizes of the joined subtree are correct.
+	@param		BinaryNode<ItemType>* leftPtr
+	@param		BinaryNode<ItemType>* middlePtr
+	@param		BinaryNode<ItemType>* rightPtr
+	@return		A pointer to the root of the joined subtree, whose parent
+					pointer the caller sets.
+	*/
+	virtual BinaryNode<ItemType>* joinNodes(BinaryNode<ItemType>* leftPtr,
+                                           BinaryNode<ItemType>* middlePtr,
+                                           BinaryNode<ItemType>* rightPtr);
+
+	/**
+	Joins two subtrees into one by detaching the leftmost node of rightPtr
+	and joining the rest around it.
+	@pre		No entry of leftPtr is greater than any entry of rightPtr.
+	@param		BinaryNode<ItemType>* leftPtr
+	@param		BinaryNode<ItemType>* rightPtr
+	@return		A pointer to the root of the joined subtree, or nullptr if
+					both subtrees are empty.
+	*/
+	BinaryNode<ItemType>* concatNodes(BinaryNode<ItemType>* leftPtr,
+                                     BinaryNode<ItemType>* rightPtr);
+
+	/**
+	Splits a subtree into the nodes before a split point and the nodes
+	after it. Descends once from the root, calling isAfter once for every
+	node on the way, and then joins the subtrees hanging off that path
+	from the bottom up, so it takes O(height) time and needs no stack.
+	@pre		isAfter returns false for every node before the split
+					point and true for every node after it, in inorder.
+	@param		BinaryNode<ItemType>* subTreePtr
+	@param		IsAfter&& isAfter
+	@param		BinaryNode<ItemType>*& lowerPtr
+					Set to the root of the nodes before the split point.
+	@param		BinaryNode<ItemType>*& upperPtr
+					Set to the root of the nodes after the split point.
+	@return		void
+	*/
+	template<class IsAfter>
+	void splitNodes(BinaryNode<ItemType>* subTreePtr, IsAfter&& isAfter,
+		BinaryNode<ItemType>*& lowerPtr, BinaryNode<ItemType>*& upperPtr);
+
+	/**
+	Splits a subtree into its entries that are less than aKey, equivalent
+	to aKey and greater than aKey.
+	@param		BinaryNode<ItemType>* subTreePtr
+	@param		const ItemType& aKey
+	@param		BinaryNode<ItemType>*& lessPtr
+	@param		BinaryNode<ItemType>*& equalPtr
+	@param		BinaryNode<ItemType>*& greaterPtr
+	@return		void
+	*/
+	void splitByKey(BinaryNode<ItemType>* subTreePtr, const ItemType& aKey,
+		BinaryNode<ItemType>*& lessPtr, BinaryNode<ItemType>*& equalPtr,
+		BinaryNode<ItemType>*& greaterPtr);
+
+	/**
+	Splits a subtree into its first count entries in inorder and the rest.
+	@param		BinaryNode<ItemType>* subTreePtr
+	@param		int count
+	@param		BinaryNode<ItemType>*& lowerPtr
+	@param		BinaryNode<ItemType>*& upperPtr
+	@return		void
+	*/
+	void splitByRank(BinaryNode<ItemType>* subTreePtr, int count,
+		BinaryNode<ItemType>*& lowerPtr, BinaryNode<ItemType>*& upperPtr);
+
+	/**
+	Merges two subtrees by the rules of std::set_union and its relatives,
+	where an entry of firstPtr that has an equivalent entry in secondPtr
+	is matched with it one to one. The matched entries of firstPtr are
+	kept if keepsMatched is true, the unmatched entries of each subtree if
+	the matching flag is true, and every other node is deleted. Both
+	subtrees are split at the median of the smaller one, so the recursion
+	is only log2 of the size of the smaller subtree deep.
+	@pre		Both subtrees belong to this tree.
+	@param		BinaryNode<ItemType>* firstPtr
+	@param		BinaryNode<ItemType>* secondPtr
+	@param		bool keepsFirstOnly
+	@param		bool keepsMatched
+	@param		bool keepsSecondOnly
+	@return		A pointer to the root of the merged subtree.
+	*/
+	BinaryNode<ItemType>* mergeNodes(BinaryNode<ItemType>* firstPtr, BinaryNode<ItemType>* secondPtr,
+		bool keepsFirstOnly, bool keepsMatched, bool keepsSecondOnly);
+
+	/**
+	Moves the entries of this tree that are not less than aKey into
+	upperTree, relinking their nodes.
+	@post		This tree holds the entries less than aKey and upperTree
+					holds the rest.
+	@param		const ItemType& aKey
+	@param		BinarySearchTree<ItemType, Compare>& upperTree
+					An empty tree with the same comparator.
+	@return		void
+	*/
+	void splitInto(const ItemType& aKey, BinarySearchTree<ItemType, Compare>& upperTree);
+
+	/**
+	Takes every node of otherTree over into this tree and returns its root,
+	leaving otherTree empty.
+	@param		BinarySearchTree<ItemType, Compare>& otherTree
+	@return		A pointer to the former root of otherTree.
+	*/
+	BinaryNode<ItemType>* takeRootFrom(BinarySearchTree<ItemType, Compare>& otherTree);
+
+	/**
+	Merges otherTree into this tree as by mergeNodes, leaving it empty.
+	@param		BinarySearchTree<ItemType, Compare>& otherTree
+	@param		bool keepsFirstOnly
+	@param		bool keepsMatched
+	@param		bool keepsSecondOnly
+	@return		void
+	@throws		PreconditionException if otherTree is this tree.
+	*/
+	void mergeWith(BinarySearchTree<ItemType, Compare>& otherTree,
+		bool keepsFirstOnly, bool keepsMatched, bool keepsSecondOnly);
    
 public:
+	typedef BinaryTreeIterator<ItemType> iterator;
+	typedef BinaryTreeIterator<ItemType> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
 	// ---------------------------------------------------------------------------
 	// Constructor and Destructor Section.
 	// ---------------------------------------------------------------------------
 
 	BinarySearchTree();
+	explicit BinarySearchTree(const Compare& treeComparator);
 	BinarySearchTree(const ItemType& rootItem);
-	BinarySearchTree(const BinarySearchTree<ItemType>& tree);
+
+	/**
+	Constructs a balanced binary search tree holding the entries in the
+	range [first, last), which need not be sorted. See assign.
+	@param		InputIterator first
+	@param		InputIterator last
+	@param		const Compare& treeComparator
+	*/
+	template<class InputIterator>
+	BinarySearchTree(InputIterator first, InputIterator last,
+		const Compare& treeComparator = Compare());
+	BinarySearchTree(const BinarySearchTree<ItemType, Compare>& tree);
+	BinarySearchTree(BinarySearchTree<ItemType, Compare>&& tree);
 	virtual ~BinarySearchTree();
    
 	// ---------------------------------------------------------------------------
@@ -106,36 +347,418 @@ public:
 	bool isEmpty() const;
 	int getHeight() const;
 	int getNumberOfNodes() const;
-	ItemType getRootData() const throw(PreconditionException);
-	void setRootData(const ItemType& newData) const throw(PreconditionException);
+	const ItemType& getRootData() const;
+	void setRootData(const ItemType& newData) const;
 	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+
+	/**
+	Adds a new entry to this binary search tree, constructing it in place
+	in a new node from the given constructor arguments.
+	@post		The tree contains the new entry in its sorted position.
+	@param		Args&&... args
+	@return		True if the addition was successful, or false if not.
+	*/
+	template<class... Args>
+	bool emplace(Args&&... args);
+
 	bool remove(const ItemType& anEntry);
 	void clear();
-	ItemType getEntry(const ItemType& anEntry) const throw(NotFoundException);
+	const ItemType& getEntry(const ItemType& anEntry) const;
 	bool contains(const ItemType& anEntry) const;
 
+	/**
+	Heterogeneous versions of getEntry and contains, which look an entry
+	up by any key that the comparator can compare with ItemType, without
+	constructing an ItemType. They are only available when Compare
+	declares is_transparent, as std::less<> does, so that a tree of
+	std::string can be searched with a std::string_view.
+	@param		const Key& aKey
+	@return		A reference to the first entry equivalent to aKey, or
+					whether such an entry occurs in the tree.
+	@throws		NotFoundException if getEntry finds no such entry.
+	*/
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	const ItemType& getEntry(const Key& aKey) const;
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	bool contains(const Key& aKey) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries of this tree.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Batch Lookup Section.
+	// A batch is sorted before it is searched, so neighbouring keys follow
+	// the same path from the root, and several descents are interleaved so
+	// that their cache misses overlap. Both methods are worth using for
+	// batches of more than a few keys on a tree that does not fit in cache.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Looks up every key in the range [first, last) and stores whether it
+	occurs in this tree, in the same order as the keys.
+	@pre		results refers to at least last - first writable elements.
+	@post		results[i] is true if first[i] occurs in the tree, or false
+					if not.
+	@param		RandomAccessIterator first
+	@param		RandomAccessIterator last
+	@param		ResultIterator results
+	@return		void
+	*/
+	template<class RandomAccessIterator, class ResultIterator>
+	void containsBatch(RandomAccessIterator first, RandomAccessIterator last,
+		ResultIterator results) const;
+
+	/**
+	Looks up every key in the range [first, last) and stores a pointer to
+	the first equivalent entry of this tree, in the same order as the
+	keys. Unlike getEntry, a missing key is not an error.
+	@pre		results refers to at least last - first writable elements.
+	@post		results[i] points to the entry found for first[i], or is
+					nullptr if there is none. The pointers are invalidated
+					by any removal from the tree.
+	@param		RandomAccessIterator first
+	@param		RandomAccessIterator last
+	@param		ResultIterator results
+	@return		void
+	*/
+	template<class RandomAccessIterator, class ResultIterator>
+	void findBatch(RandomAccessIterator first, RandomAccessIterator last,
+		ResultIterator results) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Order Statistics Section.
+	// Both queries descend once from the root using the subtree sizes cached
+	// in the nodes, so they take time proportional to the height of the tree.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns the entry at the given position in ascending order.
+	@pre		0 <= position < getNumberOfNodes().
+	@param		int position
+	@return		A reference to the entry with exactly position entries
+					before it in inorder.
+	@throws		PreconditionException if position is out of range.
+	*/
+	const ItemType& select(int position) const;
+
+	/**
+	Returns the number of entries that are less than anEntry, which is the
+	position at which anEntry is or would be inserted before any
+	equivalent entries.
+	@param		const ItemType& anEntry
+	@return		The number of entries ordered before anEntry.
+	*/
+	int rank(const ItemType& anEntry) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Range Queries Section.
+	// Each query descends once from the root and prunes every subtree that
+	// lies outside the range, so it takes O(height + k) time for k results.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns an iterator to the first entry that is not less than anEntry.
+	@param		const ItemType& anEntry
+	@return		An iterator to the entry, or end() if there is none.
+	*/
+	iterator lowerBound(const ItemType& anEntry) const;
+
+	/**
+	Returns an iterator to the first entry that is greater than anEntry.
+	@param		const ItemType& anEntry
+	@return		An iterator to the entry, or end() if there is none.
+	*/
+	iterator upperBound(const ItemType& anEntry) const;
+
+	/**
+	Returns the range of entries that are equivalent to anEntry.
+	@param		const ItemType& anEntry
+	@return		A pair of lowerBound(anEntry) and upperBound(anEntry).
+	*/
+	std::pair<iterator, iterator> equalRange(const ItemType& anEntry) const;
+
+	/**
+	Calls visit in ascending order with a constant reference to each entry
+	that is not less than low and less than high, skipping the subtrees
+	that lie outside the range. If visit returns a value, the visitation
+	stops as soon as that value is false.
+	@post		The tree is unchanged.
+	@param		const ItemType& low
+	@param		const ItemType& high
+	@param		Visitor&& visit
+	@return		True if every entry in the range was visited, or false if
+					visit stopped the visitation.
+	*/
+	template<class Visitor>
+	bool forEachInRange(const ItemType& low, const ItemType& high, Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Bulk Loading Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Replaces the entries of this tree with the entries in the range
+	[first, last), which must already be in ascending order. The tree is
+	built perfectly balanced in O(n) time, without any comparisons, and
+	all of its nodes are allocated from a single slab. If copying an
+	entry throws, the nodes built so far are destroyed, the tree is left
+	empty and the exception is passed on.
+	@pre		The range is sorted in ascending order. Duplicates are
+					allowed.
+	@post		The tree holds exactly the entries of the range and its
+					height is floor(log2(n)) + 1.
+	@param		ForwardIterator first
+	@param		ForwardIterator last
+	@return		void
+	*/
+	template<class ForwardIterator>
+	void assignSorted(ForwardIterator first, ForwardIterator last);
+
+	/**
+	Replaces the entries of this tree with the entries in the range
+	[first, last) in any order. The entries are copied into a buffer and
+	sorted unless they are already in order, and then moved into a
+	perfectly balanced tree as by assignSorted, so this takes O(n log n)
+	time.
+	@post		The tree holds exactly the entries of the range and its
+					height is floor(log2(n)) + 1.
+	@param		InputIterator first
+	@param		InputIterator last
+	@return		void
+	*/
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last);
+
+	// ---------------------------------------------------------------------------
+	// Public Persistence Section.
+	// A search tree is saved in the sorted layout of @file TreeSerialization.h:
+	// the number of entries followed by the entries in ascending order, as
+	// written by ItemCodec. These hide the shape layout of BinaryNodeTree.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Saves the entries of this tree to a stream, or to a file that is
+	replaced.
+	@post		The tree is unchanged.
+	@param		std::ostream& output
+	@return		void
+	@throws		SerializationException if the stream fails or the file
+					cannot be opened.
+	*/
+	void save(std::ostream& output) const;
+	void save(const std::string& fileName) const;
+
+	/**
+	Replaces the entries of this tree with a tree saved by save, reading
+	the stream through a buffer of fixed size. The entries are read into
+	nodes in inorder, checking that each is not less than the one before,
+	and linked into a perfectly balanced tree in O(n) time. The nodes are
+	taken from the node pool in blocks as they are read, so the count in
+	the header never decides how much memory is allocated.
+	@post		This tree holds the saved entries and its height is
+					floor(log2(n)) + 1, or it is empty if loading failed.
+	@param		std::istream& input
+	@return		void
+	@throws		SerializationException if the stream does not hold a tree
+					saved in this layout with the same kind of entries in
+					ascending order, the tree does not fit in memory, or
+					the file cannot be opened.
+	*/
+	void load(std::istream& input);
+	void load(const std::string& fileName);
+
+	// ---------------------------------------------------------------------------
+	// Public Split and Join Section.
+	// These methods move whole subtrees between trees by relinking their
+	// nodes, so no entry is copied and no node is allocated, apart from the
+	// one node join makes for its key. A split or join runs in O(height),
+	// which is O(log n) for an AVLTree. The tree that receives nodes takes a
+	// share of the slabs of the other tree, which is freed once neither
+	// tree needs it. Both trees must use equivalent comparators.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Splits this tree at aKey, moving every entry that is not less than
+	aKey into a new tree.
+	@post		This tree holds the entries less than aKey.
+	@param		const ItemType& aKey
+	@return		A tree holding the entries not less than aKey.
+	*/
+	BinarySearchTree<ItemType, Compare> split(const ItemType& aKey);
+
+	/**
+	Joins this tree, a new entry aKey and the entries of greaterTree into
+	this tree. Joining the two halves of a split with the key it was split
+	at restores the entries of the original tree.
+	@pre		No entry of this tree is greater than aKey, and no entry
+					of greaterTree is less than aKey.
+	@post		This tree holds its entries, aKey and the entries of
+					greaterTree, and greaterTree is empty.
+	@param		const ItemType& aKey
+	@param		BinarySearchTree<ItemType, Compare>& greaterTree
+	@return		void
+	@throws		PreconditionException if the entries are out of order or
+					greaterTree is this tree.
+	*/
+	void join(const ItemType& aKey, BinarySearchTree<ItemType, Compare>& greaterTree);
+
+	/**
+	Appends the entries of greaterTree to this tree, as join does without
+	a key. Concatenating the two halves of a split restores the original
+	tree.
+	@pre		No entry of greaterTree is less than any entry of this tree.
+	@post		This tree holds its entries and those of greaterTree, and
+					greaterTree is empty.
+	@param		BinarySearchTree<ItemType, Compare>& greaterTree
+	@return		void
+	@throws		PreconditionException if the entries are out of order or
+					greaterTree is this tree.
+	*/
+	void concat(BinarySearchTree<ItemType, Compare>& greaterTree);
+
+	/**
+	Set operations that merge otherTree into this tree, following
+	std::set_union, std::set_intersection and std::set_difference: an
+	entry with m equivalents in this tree and n in otherTree is kept
+	max(m, n), min(m, n) and max(m - n, 0) times, taking the entries of
+	this tree first. Nodes of both trees are relinked into the result and
+	the rest are deleted. Merging trees of m <= n entries splits both
+	trees O(m) times, which takes O(m log n) time when both are AVL trees
+	instead of the O(n log n) of adding the entries one at a time.
+	@post		This tree holds the result and otherTree is empty.
+	@param		BinarySearchTree<ItemType, Compare>& otherTree
+	@return		void
+	@throws		PreconditionException if otherTree is this tree.
+	*/
+	void unionWith(BinarySearchTree<ItemType, Compare>& otherTree);
+	void intersectWith(BinarySearchTree<ItemType, Compare>& otherTree);
+	void differenceWith(BinarySearchTree<ItemType, Compare>& otherTree);
+
+	// ---------------------------------------------------------------------------
+	// Public Snapshot Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Copies the entries of this tree into an immutable snapshot stored in
+	Eytzinger order, which is searched much faster than the linked nodes
+	when the tree is larger than the cache. The snapshot is not updated by
+	later changes to this tree. Freezing reads the tree once in inorder
+	and writes each entry straight to its final position, in O(n) time.
+	@return		A snapshot holding the entries of this tree.
+	*/
+	FrozenSearchTree<ItemType, Compare> freeze() const;
+
+	/**
+	Rebuilds the given snapshot from the entries of this tree as freeze()
+	does, reusing its memory. Freezing a tree of the same size again
+	allocates nothing.
+	@post		snapshot holds exactly the entries of this tree.
+	@param		FrozenSearchTree<ItemType, Compare>& snapshot
+	@return		void
+	*/
+	void freeze(FrozenSearchTree<ItemType, Compare>& snapshot) const;
+
+	/**
+	Writes the entries of this tree to a file that a MappedSearchTree
+	opens in O(1) time and searches in place, as a perfectly balanced tree
+	whose nodes link by relative offsets. Only available when ItemType is
+	trivially copyable.
+	@post		The tree is unchanged.
+	@param		const std::string& fileName
+	@return		void
+	@throws		SerializationException if the file cannot be written.
+	*/
+	void saveImage(const std::string& fileName) const;
+
 	// ---------------------------------------------------------------------------
 	// Public Traversals Section.
-	// See @file BinaryTreeInterface.h for documentation.
+	// See @file BinaryTreeInterface.h and @file BinaryNodeTree.h for
+	// documentation.
 	// ---------------------------------------------------------------------------
 
 	void preorderTraverse(void visit(ItemType&)) const;
 	void inorderTraverse(void visit(ItemType&)) const;
 	void postorderTraverse(void visit(ItemType&)) const;
 
+	template<class Visitor>
+	bool preorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool postorderTraverse(Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Parallel Methods Section.
+	// See @file BinaryNodeTree.h for documentation. parallelReduce combines
+	// the results in ascending order of the entries.
+	// ---------------------------------------------------------------------------
+
+	template<class Visitor>
+	void parallelForEach(Visitor&& visit) const;
+	template<class Map, class Combine>
+	typename BinaryNodeTree<ItemType>::template ReduceResult<Map> parallelReduce(Map&& map,
+		Combine&& combine) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Iterators Section.
+	// The iterators visit the entries in ascending order and are invalidated
+	// by any addition to or removal from the tree.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns an iterator to the smallest entry of this tree.
+	@return		An iterator to the first entry, or end() if the tree
+					is empty.
+	*/
+	iterator begin() const;
+
+	/**
+	Returns an iterator to the position after the largest entry of
+	this tree.
+	@return		The past-the-end iterator.
+	*/
+	iterator end() const;
+
+	/**
+	Returns a reverse iterator to the largest entry of this tree.
+	@return		A reverse iterator to the last entry, or rend() if the
+					tree is empty.
+	*/
+	reverse_iterator rbegin() const;
+
+	/**
+	Returns a reverse iterator to the position before the smallest entry
+	of this tree.
+	@return		The past-the-end reverse iterator.
+	*/
+	reverse_iterator rend() const;
+
 	// ---------------------------------------------------------------------------
 	// Overloaded Operator Section.
 	// ---------------------------------------------------------------------------
 
 	/**
 	Overloads the assignment operator = for clearing the tree and copying the
-	tree pointed to by rightHandSide to this tree. A pointer to this tree
+	tree pointed to by rightHandSide to this tree. A reference to this tree
 	is returned.
-	@post		rightHandSide is copied and a pointer to it is returned.
-	@param		const BinaryNodeTree& rightHandSide
-	@return		A pointer to this tree.
+	@post		rightHandSide is copied and a reference to this tree is returned.
+	@param		const BinarySearchTree& rightHandSide
+	@return		A reference to this tree.
+	*/
+	BinarySearchTree<ItemType, Compare>& operator=(const BinarySearchTree<ItemType, Compare>& rightHandSide);
+
+	/**
+	Overloads the assignment operator = for clearing the tree and taking
+	over the nodes of rightHandSide without copying them.
+	@post		rightHandSide is empty.
+	@param		BinarySearchTree&& rightHandSide
+	@return		A reference to this tree.
 	*/
-	BinarySearchTree<ItemType>& operator=(const BinarySearchTree<ItemType>& rightHandSide);   
+	BinarySearchTree<ItemType, Compare>& operator=(BinarySearchTree<ItemType, Compare>&& rightHandSide);
 }; // end BinarySearchTree
 
 #include "BinarySearchTree.cpp"
@@ -10,8 +10,6 @@ on and with binary trees.
 
 #pragma once
 
-#pragma warning(disable:4290)
-
 #include "NotFoundException.h"
 
 template<class ItemType>
@@ -43,9 +41,9 @@ public:
 	@pre		The binary tree is not empty.
 	@post		The root’s data has been returned and the binary
 					tree is unchanged.
-	@return		The data in the root of the binary tree.
+	@return		A reference to the data in the root of the binary tree.
 	*/
-	virtual ItemType getRootData() const = 0;
+	virtual const ItemType& getRootData() const = 0;
 
 	/**
 	Replaces the data item in the root of this binary tree
@@ -90,10 +88,11 @@ public:
 					is unchanged. If no such entry was found, a Not Found
 					Exception is thrown.
 	@param		const ItemType& anEntry
-	@return		The entry in the binary tree that matches the given entry.
+	@return		A reference to the entry in the binary tree that matches
+					the given entry.
 	@throws		NotFoundException if the given entry is not in the tree.
 	*/
-	virtual ItemType getEntry(const ItemType& anEntry) const throw(NotFoundException) = 0;
+	virtual const ItemType& getEntry(const ItemType& anEntry) const = 0;
 
 	/**
 	Tests whether a given entry occurs in this binary tree or not.
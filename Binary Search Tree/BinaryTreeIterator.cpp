@@ -0,0 +1,148 @@
+/**
+This templated class provides a bidirectional iterator that visits the
+data items of a binary tree in inorder. It follows the parent pointers
+stored in the nodes, so advancing it needs no stack and takes O(1)
+amortized time. The items are read-only because changing them could
+break the ordering of a binary search tree.
+
+@author		Solomon Colley
+@file		BinaryTreeIterator.cpp
+@since		10/18/2026
+*/
+
+#include "BinaryTreeIterator.h"
+
+// -------------------------------------------------------------------------------------
+// Constructor Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+BinaryTreeIterator<ItemType>::BinaryTreeIterator() : currentPtr(nullptr), rootPtr(nullptr)
+{
+} // end default constructor
+
+template<class ItemType>
+BinaryTreeIterator<ItemType>::BinaryTreeIterator(const BinaryNode<ItemType>* nodePtr,
+	const BinaryNode<ItemType>* treeRootPtr) : currentPtr(nodePtr), rootPtr(treeRootPtr)
+{
+} // end parameterized constructor
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+const BinaryNode<ItemType>* BinaryTreeIterator<ItemType>::getNodePtr() const
+{
+	return currentPtr;
+} // end getNodePtr
+
+template<class ItemType>
+const BinaryNode<ItemType>* BinaryTreeIterator<ItemType>::leftmost(const BinaryNode<ItemType>* subTreePtr)
+{
+	if (subTreePtr != nullptr)
+	{
+		while (subTreePtr->getLeftChildPtr() != nullptr)
+			subTreePtr = subTreePtr->getLeftChildPtr(); // end while
+	} // end if-else
+
+	return subTreePtr;
+} // end leftmost
+
+template<class ItemType>
+const BinaryNode<ItemType>* BinaryTreeIterator<ItemType>::rightmost(const BinaryNode<ItemType>* subTreePtr)
+{
+	if (subTreePtr != nullptr)
+	{
+		while (subTreePtr->getRightChildPtr() != nullptr)
+			subTreePtr = subTreePtr->getRightChildPtr(); // end while
+	} // end if-else
+
+	return subTreePtr;
+} // end rightmost
+
+// -------------------------------------------------------------------------------------
+// Overloaded Operator Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+typename BinaryTreeIterator<ItemType>::reference BinaryTreeIterator<ItemType>::operator*() const
+{
+	return currentPtr->getItem();
+} // end operator*
+
+template<class ItemType>
+typename BinaryTreeIterator<ItemType>::pointer BinaryTreeIterator<ItemType>::operator->() const
+{
+	return &currentPtr->getItem();
+} // end operator->
+
+template<class ItemType>
+BinaryTreeIterator<ItemType>& BinaryTreeIterator<ItemType>::operator++()
+{
+	if (currentPtr->getRightChildPtr() != nullptr)
+		currentPtr = leftmost(currentPtr->getRightChildPtr());
+	else
+	{
+		// Climb until the current node is reached from a left child.
+		const BinaryNode<ItemType>* childPtr = currentPtr;
+		currentPtr = currentPtr->getParentPtr();
+		while (currentPtr != nullptr && currentPtr->getRightChildPtr() == childPtr)
+		{
+			childPtr = currentPtr;
+			currentPtr = currentPtr->getParentPtr();
+		} // end while
+	} // end if-else
+
+	return *this;
+} // end operator++
+
+template<class ItemType>
+BinaryTreeIterator<ItemType> BinaryTreeIterator<ItemType>::operator++(int)
+{
+	BinaryTreeIterator<ItemType> previous = *this;
+	++(*this);
+	return previous;
+} // end operator++
+
+template<class ItemType>
+BinaryTreeIterator<ItemType>& BinaryTreeIterator<ItemType>::operator--()
+{
+	if (currentPtr == nullptr)	// Step back from the end.
+		currentPtr = rightmost(rootPtr);
+	else if (currentPtr->getLeftChildPtr() != nullptr)
+		currentPtr = rightmost(currentPtr->getLeftChildPtr());
+	else
+	{
+		// Climb until the current node is reached from a right child.
+		const BinaryNode<ItemType>* childPtr = currentPtr;
+		currentPtr = currentPtr->getParentPtr();
+		while (currentPtr != nullptr && currentPtr->getLeftChildPtr() == childPtr)
+		{
+			childPtr = currentPtr;
+			currentPtr = currentPtr->getParentPtr();
+		} // end while
+	} // end if-else
+
+	return *this;
+} // end operator--
+
+template<class ItemType>
+BinaryTreeIterator<ItemType> BinaryTreeIterator<ItemType>::operator--(int)
+{
+	BinaryTreeIterator<ItemType> previous = *this;
+	--(*this);
+	return previous;
+} // end operator--
+
+template<class ItemType>
+bool BinaryTreeIterator<ItemType>::operator==(const BinaryTreeIterator<ItemType>& rightHandSide) const
+{
+	return currentPtr == rightHandSide.currentPtr;
+} // end operator==
+
+template<class ItemType>
+bool BinaryTreeIterator<ItemType>::operator!=(const BinaryTreeIterator<ItemType>& rightHandSide) const
+{
+	return currentPtr != rightHandSide.currentPtr;
+} // end operator!=
@@ -0,0 +1,99 @@
+/**
+This templated class provides a bidirectional iterator that visits the
+data items of a binary tree in inorder. It follows the parent pointers
+stored in the nodes, so advancing it needs no stack and takes O(1)
+amortized time. The items are read-only because changing them could
+break the ordering of a binary search tree.
+
+@author		Solomon Colley
+@file		BinaryTreeIterator.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include "BinaryNode.h"
+
+template<class ItemType>
+class BinaryTreeIterator
+{
+private:
+	const BinaryNode<ItemType>* currentPtr;	// Node at the current position, or nullptr at the end.
+	const BinaryNode<ItemType>* rootPtr;	// Root of the iterated tree, used to step back from the end.
+
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const ItemType* pointer;
+	typedef const ItemType& reference;
+
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// -------------------------------------------------------------------------------------
+
+	BinaryTreeIterator();
+	BinaryTreeIterator(const BinaryNode<ItemType>* nodePtr, const BinaryNode<ItemType>* treeRootPtr);
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Returns the node at the current position of this iterator.
+	@return		A pointer to the current node, or nullptr at the end.
+	*/
+	const BinaryNode<ItemType>* getNodePtr() const;
+
+	/**
+	Returns the leftmost node of the given subtree.
+	@param		const BinaryNode<ItemType>* subTreePtr
+	@return		A pointer to the node with the smallest item, or nullptr
+					if the subtree is empty.
+	*/
+	static const BinaryNode<ItemType>* leftmost(const BinaryNode<ItemType>* subTreePtr);
+
+	/**
+	Returns the rightmost node of the given subtree.
+	@param		const BinaryNode<ItemType>* subTreePtr
+	@return		A pointer to the node with the largest item, or nullptr
+					if the subtree is empty.
+	*/
+	static const BinaryNode<ItemType>* rightmost(const BinaryNode<ItemType>* subTreePtr);
+
+	// -------------------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Returns the data item at the current position.
+	@pre		The iterator is not at the end.
+	@return		A reference to the current data item.
+	*/
+	reference operator*() const;
+	pointer operator->() const;
+
+	/**
+	Moves this iterator to the inorder successor of the current node.
+	@pre		The iterator is not at the end.
+	@return		This iterator, or a copy of it from before the move.
+	*/
+	BinaryTreeIterator& operator++();
+	BinaryTreeIterator operator++(int);
+
+	/**
+	Moves this iterator to the inorder predecessor of the current node, or
+	to the last node when it is at the end.
+	@pre		The iterator is not at the first node.
+	@return		This iterator, or a copy of it from before the move.
+	*/
+	BinaryTreeIterator& operator--();
+	BinaryTreeIterator operator--(int);
+
+	bool operator==(const BinaryTreeIterator& rightHandSide) const;
+	bool operator!=(const BinaryTreeIterator& rightHandSide) const;
+}; // end BinaryTreeIterator
+
+#include "BinaryTreeIterator.cpp"
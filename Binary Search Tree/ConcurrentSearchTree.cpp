@@ -0,0 +1,376 @@
+/**
+This templated class provides a binary search tree that many threads can
+use at once. Lookups and traversals take no locks: they run inside an
+EpochGuard and follow atomic child links, while writers take turns on a
+mutex. A writer never changes a node that readers can reach except to
+swing one child link, so every reader sees a valid tree. A removed node
+with two children is replaced by a copy of its successor, with copies of
+the nodes between them, published by one store. The spine of the
+subtree that takes a removed node's place is copied as well, where the
+entries between the removed node and its neighbor would be added later.
+Unlinked nodes are handed to the EpochManager, which deletes them once
+no reader can hold them.
+
+Writers read the links with relaxed loads, since only the thread holding
+the mutex changes them, and publish new links with release stores that
+the acquire loads of the readers pair with.
+
+@author		Solomon Colley
+@file		ConcurrentSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "ConcurrentSearchTree.h"
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+ConcurrentSearchTree<ItemType, Compare>::Node::Node(const ItemType& anItem, Node* leftPtr, Node* rightPtr)
+	: item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+bool ConcurrentSearchTree<ItemType, Compare>::lessThan(const ItemType& left, const ItemType& right) const
+{
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+const typename ConcurrentSearchTree<ItemType, Compare>::Node*
+ConcurrentSearchTree<ItemType, Compare>::findNode(const ItemType& target) const
+{
+	const Node* candidatePtr = nullptr;	// Last node not less than the target.
+	const Node* currentPtr = rootPtr.load(std::memory_order_acquire);
+
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(currentPtr->item, target))
+			currentPtr = currentPtr->rightChildPtr.load(std::memory_order_acquire);
+		else
+		{
+			// Search the left subtree for an earlier match.
+			candidatePtr = currentPtr;
+			currentPtr = currentPtr->leftChildPtr.load(std::memory_order_acquire);
+		} // end if-else
+	} // end while
+
+	if (candidatePtr == nullptr || lessThan(target, candidatePtr->item))
+		return nullptr;	// The node was not found.
+	else
+		return candidatePtr; // end if-else
+} // end findNode
+
+template<class ItemType, class Compare>
+typename ConcurrentSearchTree<ItemType, Compare>::Node* ConcurrentSearchTree<ItemType, Compare>::copySpine(
+	Node* subTreePtr, bool isLeftSpine, std::vector<Node*>& copyPtrs, std::vector<Node*>& spinePtrs)
+{
+	std::size_t firstIndex = spinePtrs.size();
+	for (Node* nodePtr = subTreePtr; nodePtr != nullptr;
+		nodePtr = (isLeftSpine ? nodePtr->leftChildPtr : nodePtr->rightChildPtr).load(std::memory_order_relaxed))
+		spinePtrs.push_back(nodePtr); // end for
+
+	// Build the copies from the bottom up, each above the copy below it.
+	Node* copyPtr = nullptr;
+	try
+	{
+		for (std::size_t i = spinePtrs.size(); i > firstIndex; --i)
+		{
+			Node* spinePtr = spinePtrs[i - 1];
+			if (isLeftSpine)
+				copyPtr = new Node(spinePtr->item, copyPtr, spinePtr->rightChildPtr.load(std::memory_order_relaxed));
+			else
+				copyPtr = new Node(spinePtr->item, spinePtr->leftChildPtr.load(std::memory_order_relaxed), copyPtr); // end if-else
+			copyPtrs.push_back(copyPtr);
+		} // end for
+	}
+	catch (...)
+	{
+		// The originals stay in the tree.
+		spinePtrs.resize(firstIndex);
+		throw;
+	} // end try-catch
+
+	return copyPtr;
+} // end copySpine
+
+template<class ItemType, class Compare>
+void ConcurrentSearchTree<ItemType, Compare>::destroyTree(void* subTreePtr)
+{
+	// Rotating each left child up flattens the subtree into a list of right
+	// children without a stack, however deep the tree has grown.
+	Node* currentPtr = static_cast<Node*>(subTreePtr);
+	while (currentPtr != nullptr)
+	{
+		Node* leftPtr = currentPtr->leftChildPtr.load(std::memory_order_relaxed);
+		if (leftPtr != nullptr)
+		{
+			currentPtr->leftChildPtr.store(leftPtr->rightChildPtr.load(std::memory_order_relaxed),
+				std::memory_order_relaxed);
+			leftPtr->rightChildPtr.store(currentPtr, std::memory_order_relaxed);
+			currentPtr = leftPtr;
+		}
+		else
+		{
+			Node* rightPtr = currentPtr->rightChildPtr.load(std::memory_order_relaxed);
+			delete currentPtr;
+			currentPtr = rightPtr;
+		} // end if-else
+	} // end while
+} // end destroyTree
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::preorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return applyVisitor(visit, subTreePtr->item)
+		&& preorderVisit(visit, subTreePtr->leftChildPtr.load(std::memory_order_acquire))
+		&& preorderVisit(visit, subTreePtr->rightChildPtr.load(std::memory_order_acquire));
+} // end preorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::inorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return inorderVisit(visit, subTreePtr->leftChildPtr.load(std::memory_order_acquire))
+		&& applyVisitor(visit, subTreePtr->item)
+		&& inorderVisit(visit, subTreePtr->rightChildPtr.load(std::memory_order_acquire));
+} // end inorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::postorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return postorderVisit(visit, subTreePtr->leftChildPtr.load(std::memory_order_acquire))
+		&& postorderVisit(visit, subTreePtr->rightChildPtr.load(std::memory_order_acquire))
+		&& applyVisitor(visit, subTreePtr->item);
+} // end postorderVisit
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+ConcurrentSearchTree<ItemType, Compare>::ConcurrentSearchTree() : rootPtr(nullptr), entryCount(0),
+	comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+ConcurrentSearchTree<ItemType, Compare>::ConcurrentSearchTree(const Compare& treeComparator)
+	: rootPtr(nullptr), entryCount(0), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+ConcurrentSearchTree<ItemType, Compare>::~ConcurrentSearchTree()
+{
+	destroyTree(rootPtr.load(std::memory_order_acquire));
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool ConcurrentSearchTree<ItemType, Compare>::isEmpty() const
+{
+	return rootPtr.load(std::memory_order_acquire) == nullptr;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int ConcurrentSearchTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return entryCount.load(std::memory_order_relaxed);
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+bool ConcurrentSearchTree<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	Node* newNodePtr = new Node(newEntry, nullptr, nullptr);
+
+	std::lock_guard<std::mutex> lock(writerMutex);
+
+	// Equivalent entries go to the right, as in BinarySearchTree.
+	std::atomic<Node*>* linkPtr = &rootPtr;
+	Node* currentPtr = linkPtr->load(std::memory_order_relaxed);
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(newEntry, currentPtr->item))
+			linkPtr = &currentPtr->leftChildPtr;
+		else
+			linkPtr = &currentPtr->rightChildPtr; // end if-else
+		currentPtr = linkPtr->load(std::memory_order_relaxed);
+	} // end while
+
+	linkPtr->store(newNodePtr, std::memory_order_release);
+	entryCount.fetch_add(1, std::memory_order_relaxed);
+	return true;
+} // end add
+
+template<class ItemType, class Compare>
+bool ConcurrentSearchTree<ItemType, Compare>::remove(const ItemType& anEntry)
+{
+	std::lock_guard<std::mutex> lock(writerMutex);
+
+	// Finds the link to the first equivalent node, as findNode does.
+	std::atomic<Node*>* targetLinkPtr = nullptr;
+	std::atomic<Node*>* linkPtr = &rootPtr;
+	Node* currentPtr = linkPtr->load(std::memory_order_relaxed);
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(currentPtr->item, anEntry))
+			linkPtr = &currentPtr->rightChildPtr;
+		else
+		{
+			targetLinkPtr = linkPtr;
+			linkPtr = &currentPtr->leftChildPtr;
+		} // end if-else
+		currentPtr = linkPtr->load(std::memory_order_relaxed);
+	} // end while
+
+	if (targetLinkPtr == nullptr)
+		return false; // end if-else
+
+	Node* targetPtr = targetLinkPtr->load(std::memory_order_relaxed);
+	if (lessThan(anEntry, targetPtr->item))
+		return false; // end if-else
+
+	Node* leftPtr = targetPtr->leftChildPtr.load(std::memory_order_relaxed);
+	Node* rightPtr = targetPtr->rightChildPtr.load(std::memory_order_relaxed);
+
+	// The removal widens the range of entries that may later be added below
+	// the subtrees taking the target's place, so the spines they would be
+	// added at are copied, along with the successor and the nodes above it
+	// when it moves up. The copies are published together by one store.
+	std::vector<Node*> copyPtrs;
+	std::vector<Node*> replacedPtrs;
+	Node* replacementPtr = nullptr;
+	try
+	{
+		if (rightPtr == nullptr)
+			replacementPtr = copySpine(leftPtr, false, copyPtrs, replacedPtrs);
+		else if (leftPtr == nullptr)
+			replacementPtr = copySpine(rightPtr, true, copyPtrs, replacedPtrs);
+		else
+		{
+			// Moving the successor in place would let a reader on its way
+			// down to it miss it, so the successor and the nodes above it up
+			// to the right child are copied.
+			std::vector<Node*> pathPtrs;
+			Node* successorPtr = rightPtr;
+			for (Node* nextPtr = successorPtr->leftChildPtr.load(std::memory_order_relaxed); nextPtr != nullptr;
+				nextPtr = nextPtr->leftChildPtr.load(std::memory_order_relaxed))
+			{
+				pathPtrs.push_back(successorPtr);
+				successorPtr = nextPtr;
+			} // end for
+
+			Node* subTreePtr = successorPtr->rightChildPtr.load(std::memory_order_relaxed);
+			for (auto pathIterator = pathPtrs.rbegin(); pathIterator != pathPtrs.rend(); ++pathIterator)
+			{
+				subTreePtr = new Node((*pathIterator)->item, subTreePtr,
+					(*pathIterator)->rightChildPtr.load(std::memory_order_relaxed));
+				copyPtrs.push_back(subTreePtr);
+			} // end for
+
+			Node* newLeftPtr = copySpine(leftPtr, false, copyPtrs, replacedPtrs);
+			replacementPtr = new Node(successorPtr->item, newLeftPtr, subTreePtr);
+			copyPtrs.push_back(replacementPtr);
+
+			replacedPtrs.insert(replacedPtrs.end(), pathPtrs.begin(), pathPtrs.end());
+			replacedPtrs.push_back(successorPtr);
+		} // end if-else
+	}
+	catch (...)
+	{
+		// Nothing was published, so the copies can be deleted at once.
+		for (Node* copyPtr : copyPtrs)
+			delete copyPtr; // end for
+		throw;
+	} // end try-catch
+
+	targetLinkPtr->store(replacementPtr, std::memory_order_release);
+
+	EpochManager::retire(targetPtr);
+	for (Node* replacedPtr : replacedPtrs)
+		EpochManager::retire(replacedPtr); // end for
+
+	entryCount.fetch_sub(1, std::memory_order_relaxed);
+	return true;
+} // end remove
+
+template<class ItemType, class Compare>
+void ConcurrentSearchTree<ItemType, Compare>::clear()
+{
+	std::lock_guard<std::mutex> lock(writerMutex);
+
+	Node* oldRootPtr = rootPtr.exchange(nullptr, std::memory_order_acq_rel);
+	if (oldRootPtr != nullptr)
+		EpochManager::retire(oldRootPtr, &ConcurrentSearchTree<ItemType, Compare>::destroyTree); // end if-else
+	entryCount.store(0, std::memory_order_relaxed);
+} // end clear
+
+template<class ItemType, class Compare>
+ItemType ConcurrentSearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	EpochGuard guard;
+	const Node* nodeWithEntry = findNode(anEntry);
+
+	if (nodeWithEntry == nullptr)
+		throw NotFoundException("The entry does not exist within the concurrent search tree.");
+	else
+		return nodeWithEntry->item; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool ConcurrentSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	EpochGuard guard;
+	return findNode(anEntry) != nullptr;
+} // end contains
+
+template<class ItemType, class Compare>
+Compare ConcurrentSearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Traversals Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::preorderTraverse(Visitor&& visit) const
+{
+	EpochGuard guard;
+	return preorderVisit(visit, rootPtr.load(std::memory_order_acquire));
+} // end preorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	EpochGuard guard;
+	return inorderVisit(visit, rootPtr.load(std::memory_order_acquire));
+} // end inorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool ConcurrentSearchTree<ItemType, Compare>::postorderTraverse(Visitor&& visit) const
+{
+	EpochGuard guard;
+	return postorderVisit(visit, rootPtr.load(std::memory_order_acquire));
+} // end postorderTraverse
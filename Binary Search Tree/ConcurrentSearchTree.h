@@ -0,0 +1,210 @@
+/**
+This templated class provides a binary search tree that many threads can
+use at once. Lookups and traversals take no locks: they run inside an
+EpochGuard and follow atomic child links, while writers take turns on a
+mutex. A writer never changes a node that readers can reach except to
+swing one child link, so every reader sees a valid tree. A removed node
+with two children is replaced by a copy of its successor, with copies of
+the nodes between them, published by one store. The spine of the
+subtree that takes a removed node's place is copied as well, where the
+entries between the removed node and its neighbor would be added later. Unlinked nodes are handed
+to the EpochManager, which deletes them once no reader can hold them.
+
+The tree is not balanced, like BinarySearchTree, since a rotation would
+have to copy the rotated nodes as well.
+
+@author		Solomon Colley
+@file		ConcurrentSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "EpochManager.h"
+#include "NotFoundException.h"
+#include "TreeVisitor.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class ConcurrentSearchTree
+{
+private:
+	/**
+	A node of the tree. The item of a node that readers can reach is never
+	changed, and its child links are only swung to a fully built subtree.
+	*/
+	struct Node
+	{
+		ItemType item;							// Data portion.
+		std::atomic<Node*> leftChildPtr;		// Pointer to the left child.
+		std::atomic<Node*> rightChildPtr;		// Pointer to the right child.
+
+		Node(const ItemType& anItem, Node* leftPtr, Node* rightPtr);
+	}; // end Node
+
+	std::atomic<Node*> rootPtr;			// Root node, or nullptr if the tree is empty.
+	std::atomic<int> entryCount;		// Number of entries in the tree.
+	Compare comparator;					// Strict weak ordering of the entries.
+	std::mutex writerMutex;				// Held by the thread changing the tree.
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree.
+	@param		const ItemType& left
+	@param		const ItemType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	bool lessThan(const ItemType& left, const ItemType& right) const;
+
+	/**
+	Returns the first node in inorder whose item is equivalent to target,
+	with one comparison per level.
+	@pre		The caller holds an EpochGuard.
+	@param		const ItemType& target
+	@return		A pointer to the node, or nullptr if there is none.
+	*/
+	const Node* findNode(const ItemType& target) const;
+
+	/**
+	Copies the left or right spine of a subtree, the path from its root
+	along left or right children. Each copy keeps the other subtree of its
+	original. A removal widens the range of entries that may be added at
+	the bottom of that spine; with the spine copied, such an addition lands
+	in a copy, never below a node that a reader of the old tree may still
+	visit, where it would be seen out of order.
+	@pre		The caller holds the writer mutex.
+	@param		Node* subTreePtr
+	@param		bool isLeftSpine
+	@param		std::vector<Node*>& copyPtrs receives the copies.
+	@param		std::vector<Node*>& spinePtrs receives the originals, to be
+					retired once the copies are published.
+	@return		The copy of subTreePtr, or nullptr if it is nullptr.
+	*/
+	static Node* copySpine(Node* subTreePtr, bool isLeftSpine, std::vector<Node*>& copyPtrs,
+		std::vector<Node*>& spinePtrs);
+
+	/**
+	Deletes every node of the subtree of a node at once, for use as an
+	EpochManager destroy function as well.
+	@param		void* subTreePtr
+	@return		void
+	*/
+	static void destroyTree(void* subTreePtr);
+
+	/**
+	Traverses the subtree of subTreePtr, stopping as soon as visit returns
+	false.
+	@pre		The caller holds an EpochGuard.
+	@param		Visitor& visit
+	@param		const Node* subTreePtr
+	@return		True if every entry was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	static bool preorderVisit(Visitor& visit, const Node* subTreePtr);
+	template<class Visitor>
+	static bool inorderVisit(Visitor& visit, const Node* subTreePtr);
+	template<class Visitor>
+	static bool postorderVisit(Visitor& visit, const Node* subTreePtr);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	ConcurrentSearchTree();
+	explicit ConcurrentSearchTree(const Compare& treeComparator);
+
+	/**
+	Deletes every node.
+	@pre		No other thread is using the tree.
+	*/
+	virtual ~ConcurrentSearchTree();
+
+	ConcurrentSearchTree(const ConcurrentSearchTree<ItemType, Compare>& tree) = delete;
+	ConcurrentSearchTree& operator=(const ConcurrentSearchTree<ItemType, Compare>& rightHandSide) = delete;
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// Every method may be called by any number of threads at once. The
+	// lookups and traversals never block; add, remove and clear wait for
+	// each other but not for readers.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+	int getNumberOfNodes() const;
+
+	/**
+	Adds a new entry after any equivalent entries. The node is allocated
+	before the writer lock is taken.
+	@post		The tree holds the new entry.
+	@param		const ItemType& newEntry
+	@return		True, since the entry is always added.
+	*/
+	bool add(const ItemType& newEntry);
+
+	/**
+	Removes the first entry in inorder that is equivalent to anEntry. The
+	unlinked nodes are retired rather than deleted.
+	@post		One equivalent entry was removed if there was any.
+	@param		const ItemType& anEntry
+	@return		True if an entry was removed, or false if not.
+	*/
+	bool remove(const ItemType& anEntry);
+
+	/**
+	Removes every entry. The old nodes are retired as one subtree.
+	@post		The tree is empty.
+	@return		void
+	*/
+	void clear();
+
+	/**
+	Returns a copy of the first entry equivalent to anEntry. A reference
+	could outlive the node, which may be deleted once it is removed.
+	@param		const ItemType& anEntry
+	@return		A copy of the entry.
+	@throws		NotFoundException if there is no such entry.
+	*/
+	ItemType getEntry(const ItemType& anEntry) const;
+
+	/**
+	Returns whether an entry equivalent to anEntry occurs in the tree.
+	@param		const ItemType& anEntry
+	@return		True if the entry was found, or false if not.
+	*/
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries of this tree.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Traversals Section.
+	// The traversals pass a constant reference to each entry to visit and
+	// stop as soon as visit returns false, as in BinarySearchTree. They hold
+	// an EpochGuard throughout, so the nodes they reach stay valid, and they
+	// see every entry that is in the tree for the whole traversal. Entries
+	// added or removed meanwhile may or may not be seen, but an inorder
+	// traversal always visits its entries in ascending order.
+	// ---------------------------------------------------------------------------
+
+	template<class Visitor>
+	bool preorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool postorderTraverse(Visitor&& visit) const;
+}; // end ConcurrentSearchTree
+
+#include "ConcurrentSearchTree.cpp"
@@ -0,0 +1,205 @@
+/**
+This class provides epoch-based reclamation for concurrent data
+structures whose readers take no locks. A reader marks the section in
+which it may hold pointers into a structure with an EpochGuard. A writer
+that unlinks an object retires it instead of deleting it, and the object
+is only deleted once every reader that might still see it has left its
+guard. The epochs are shared by every structure in the process.
+
+An object retired in epoch e was unlinked before the epoch was read, so
+a reader that entered in epoch e + 1 or later cannot reach it. The epoch
+only advances past e + 1 once every thread inside a guard has entered
+e + 1, so by epoch e + 2 no reader can still hold the object.
+
+@author		Solomon Colley
+@file		EpochManager.cpp
+@since		10/18/2026
+*/
+
+#include "EpochManager.h"
+
+// -------------------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// -------------------------------------------------------------------------------------
+
+EpochManager::ThreadRecord::ThreadRecord() : activeEpoch(0), isClaimed(false), nestingDepth(0),
+	retiresSinceCollection(0), nextPtr(nullptr)
+{
+} // end default constructor
+
+EpochManager::RecordOwner::RecordOwner() : recordPtr(nullptr)
+{
+} // end default constructor
+
+EpochManager::RecordOwner::~RecordOwner()
+{
+	if (recordPtr != nullptr)
+	{
+		recordPtr->nestingDepth = 0;
+		recordPtr->activeEpoch.store(0, std::memory_order_release);
+		recordPtr->isClaimed.store(false, std::memory_order_release);
+	} // end if-else
+} // end destructor
+
+EpochManager::EpochManager() : globalEpoch(1), recordsPtr(nullptr)
+{
+} // end default constructor
+
+EpochManager::~EpochManager()
+{
+	// Only the exiting main thread is left, so everything can be deleted.
+	ThreadRecord* recordPtr = recordsPtr.load(std::memory_order_acquire);
+	while (recordPtr != nullptr)
+	{
+		for (const RetiredObject& object : recordPtr->retired)
+			object.destroy(object.objectPtr); // end for
+
+		ThreadRecord* nextRecordPtr = recordPtr->nextPtr;
+		delete recordPtr;
+		recordPtr = nextRecordPtr;
+	} // end while
+} // end destructor
+
+// -------------------------------------------------------------------------------------
+// Private Utility Methods Section.
+// -------------------------------------------------------------------------------------
+
+EpochManager& EpochManager::getInstance()
+{
+	static EpochManager manager;
+	return manager;
+} // end getInstance
+
+EpochManager::ThreadRecord* EpochManager::getThreadRecord()
+{
+	static thread_local RecordOwner owner;
+
+	if (owner.recordPtr != nullptr)
+		return owner.recordPtr; // end if-else
+
+	// Reuse the record of a thread that has exited.
+	for (ThreadRecord* recordPtr = recordsPtr.load(std::memory_order_acquire); recordPtr != nullptr;
+		recordPtr = recordPtr->nextPtr)
+	{
+		bool isClaimed = false;
+		if (!recordPtr->isClaimed.load(std::memory_order_relaxed)
+			&& recordPtr->isClaimed.compare_exchange_strong(isClaimed, true, std::memory_order_acquire))
+		{
+			owner.recordPtr = recordPtr;
+			return recordPtr;
+		} // end if-else
+	} // end for
+
+	ThreadRecord* newRecordPtr = new ThreadRecord();
+	newRecordPtr->isClaimed.store(true, std::memory_order_relaxed);
+
+	ThreadRecord* headPtr = recordsPtr.load(std::memory_order_relaxed);
+	do
+	{
+		newRecordPtr->nextPtr = headPtr;
+	} while (!recordsPtr.compare_exchange_weak(headPtr, newRecordPtr, std::memory_order_release,
+		std::memory_order_relaxed)); // end do-while
+
+	owner.recordPtr = newRecordPtr;
+	return newRecordPtr;
+} // end getThreadRecord
+
+std::uint64_t EpochManager::tryAdvance()
+{
+	std::uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+
+	for (ThreadRecord* recordPtr = recordsPtr.load(std::memory_order_acquire); recordPtr != nullptr;
+		recordPtr = recordPtr->nextPtr)
+	{
+		std::uint64_t activeEpoch = recordPtr->activeEpoch.load(std::memory_order_seq_cst);
+		if (activeEpoch != 0 && activeEpoch != epoch)
+			return epoch;	// A reader is still in an earlier epoch.
+	} // end for
+
+	// If another thread advanced first, epoch is updated to the new value.
+	if (globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst))
+		return epoch + 1;
+	else
+		return epoch; // end if-else
+} // end tryAdvance
+
+void EpochManager::reclaim(ThreadRecord* recordPtr, std::uint64_t currentEpoch)
+{
+	std::vector<RetiredObject>& retired = recordPtr->retired;
+
+	std::size_t reclaimable = 0;
+	while (reclaimable < retired.size() && retired[reclaimable].retireEpoch + 2 <= currentEpoch)
+	{
+		retired[reclaimable].destroy(retired[reclaimable].objectPtr);
+		++reclaimable;
+	} // end while
+
+	retired.erase(retired.begin(), retired.begin() + reclaimable);
+} // end reclaim
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+void EpochManager::enterReader()
+{
+	EpochManager& manager = getInstance();
+	ThreadRecord* recordPtr = manager.getThreadRecord();
+
+	if (recordPtr->nestingDepth++ == 0)
+	{
+		// The store must be ordered before the loads of the guarded section.
+		std::uint64_t epoch = manager.globalEpoch.load(std::memory_order_seq_cst);
+		recordPtr->activeEpoch.store(epoch, std::memory_order_seq_cst);
+	} // end if-else
+} // end enterReader
+
+void EpochManager::exitReader()
+{
+	ThreadRecord* recordPtr = getInstance().getThreadRecord();
+
+	if (--recordPtr->nestingDepth == 0)
+		recordPtr->activeEpoch.store(0, std::memory_order_release); // end if-else
+} // end exitReader
+
+void EpochManager::retire(void* objectPtr, void (*destroy)(void*))
+{
+	EpochManager& manager = getInstance();
+	ThreadRecord* recordPtr = manager.getThreadRecord();
+
+	// Orders the unlinking store of the caller before the epoch is read.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	RetiredObject object = { objectPtr, destroy, manager.globalEpoch.load(std::memory_order_seq_cst) };
+	recordPtr->retired.push_back(object);
+
+	if (++recordPtr->retiresSinceCollection >= RETIRES_PER_COLLECTION)
+		collect(); // end if-else
+} // end retire
+
+void EpochManager::collect()
+{
+	EpochManager& manager = getInstance();
+	ThreadRecord* recordPtr = manager.getThreadRecord();
+
+	recordPtr->retiresSinceCollection = 0;
+	reclaim(recordPtr, manager.tryAdvance());
+} // end collect
+
+int EpochManager::getPendingCount()
+{
+	return static_cast<int>(getInstance().getThreadRecord()->retired.size());
+} // end getPendingCount
+
+// -------------------------------------------------------------------------------------
+// EpochGuard Constructor and Destructor Section.
+// -------------------------------------------------------------------------------------
+
+EpochGuard::EpochGuard()
+{
+	EpochManager::enterReader();
+} // end default constructor
+
+EpochGuard::~EpochGuard()
+{
+	EpochManager::exitReader();
+} // end destructor
@@ -0,0 +1,190 @@
+/**
+This class provides epoch-based reclamation for concurrent data
+structures whose readers take no locks. A reader marks the section in
+which it may hold pointers into a structure with an EpochGuard. A writer
+that unlinks an object retires it instead of deleting it, and the object
+is only deleted once every reader that might still see it has left its
+guard. The epochs are shared by every structure in the process.
+
+@author		Solomon Colley
+@file		EpochManager.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class EpochManager
+{
+public:
+	static const int RETIRES_PER_COLLECTION = 128;	// Retired objects between attempts to reclaim.
+
+private:
+	/**
+	An object waiting to be deleted, and the epoch in which it was retired.
+	*/
+	struct RetiredObject
+	{
+		void* objectPtr;				// The unlinked object.
+		void (*destroy)(void*);			// Deletes the object.
+		std::uint64_t retireEpoch;		// Global epoch when it was retired.
+	}; // end RetiredObject
+
+	/**
+	The state of one thread. A record is reused by a later thread once its
+	thread exits, together with any objects it still has to delete.
+	*/
+	struct ThreadRecord
+	{
+		std::atomic<std::uint64_t> activeEpoch;	// Epoch the thread entered, or 0 outside a guard.
+		std::atomic<bool> isClaimed;			// Whether a running thread owns this record.
+		int nestingDepth;						// Number of guards the thread holds.
+		int retiresSinceCollection;				// Objects retired since the last collection.
+		std::vector<RetiredObject> retired;		// Objects retired by the thread, oldest first.
+		ThreadRecord* nextPtr;					// Next record in the list of all records.
+
+		ThreadRecord();
+	}; // end ThreadRecord
+
+	/**
+	Releases the record of a thread when the thread exits.
+	*/
+	struct RecordOwner
+	{
+		ThreadRecord* recordPtr;
+
+		RecordOwner();
+		~RecordOwner();
+	}; // end RecordOwner
+
+	std::atomic<std::uint64_t> globalEpoch;		// Current epoch, starting at 1.
+	std::atomic<ThreadRecord*> recordsPtr;		// Head of the list of all records, which only grows.
+
+	EpochManager();
+	~EpochManager();
+
+	/**
+	Returns the only epoch manager of the process.
+	@return		A reference to the manager.
+	*/
+	static EpochManager& getInstance();
+
+	/**
+	Returns the record of the calling thread, claiming a free record or
+	adding a new one on the first call from the thread.
+	@return		A pointer to the record.
+	*/
+	ThreadRecord* getThreadRecord();
+
+	/**
+	Advances the global epoch if every thread inside a guard has entered
+	the current epoch.
+	@return		The global epoch after the attempt.
+	*/
+	std::uint64_t tryAdvance();
+
+	/**
+	Deletes the objects retired by the given record at least two epochs
+	before the current one, which no reader can still see.
+	@param		ThreadRecord* recordPtr
+	@param		std::uint64_t currentEpoch
+	@return		void
+	*/
+	static void reclaim(ThreadRecord* recordPtr, std::uint64_t currentEpoch);
+
+	/**
+	Deletes an object of type Object, for use as a destroy function.
+	@param		void* objectPtr
+	@return		void
+	*/
+	template<class Object>
+	static void deleteObject(void* objectPtr);
+
+public:
+	EpochManager(const EpochManager& manager) = delete;
+	EpochManager& operator=(const EpochManager& rightHandSide) = delete;
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Marks the calling thread as reading. Guards may be nested.
+	@post		No object retired from now on is deleted until the matching
+					call to exitReader.
+	@return		void
+	*/
+	static void enterReader();
+
+	/**
+	Marks the end of the innermost read section of the calling thread.
+	@pre		The thread called enterReader.
+	@return		void
+	*/
+	static void exitReader();
+
+	/**
+	Schedules an object that is no longer reachable for new readers to be
+	deleted once the readers that could still see it are done.
+	@pre		The object was unlinked before the call and is retired once.
+	@param		void* objectPtr
+	@param		void (*destroy)(void*)
+	@return		void
+	*/
+	static void retire(void* objectPtr, void (*destroy)(void*));
+
+	/**
+	Schedules an object allocated with new to be deleted later, as above.
+	@param		Object* objectPtr
+	@return		void
+	*/
+	template<class Object>
+	static void retire(Object* objectPtr);
+
+	/**
+	Advances the epoch where possible and deletes the objects retired by
+	the calling thread that are no longer visible to any reader.
+	@return		void
+	*/
+	static void collect();
+
+	/**
+	Returns the number of objects the calling thread has retired but not
+	yet deleted.
+	@return		The number of pending objects.
+	*/
+	static int getPendingCount();
+}; // end EpochManager
+
+/**
+Keeps the calling thread inside a read section for the lifetime of the
+guard.
+*/
+class EpochGuard
+{
+public:
+	EpochGuard();
+	~EpochGuard();
+
+	EpochGuard(const EpochGuard& guard) = delete;
+	EpochGuard& operator=(const EpochGuard& rightHandSide) = delete;
+}; // end EpochGuard
+
+// -------------------------------------------------------------------------------------
+// Template Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class Object>
+void EpochManager::deleteObject(void* objectPtr)
+{
+	delete static_cast<Object*>(objectPtr);
+} // end deleteObject
+
+template<class Object>
+void EpochManager::retire(Object* objectPtr)
+{
+	retire(objectPtr, &EpochManager::deleteObject<Object>);
+} // end retire
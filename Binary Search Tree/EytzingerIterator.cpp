@@ -0,0 +1,167 @@
+/**
+This templated class provides a bidirectional iterator that visits the
+data items of a tree stored in Eytzinger order in ascending order. In
+that layout the entry at index k has its children at 2k and 2k + 1 and
+the root is at index 1, so the inorder neighbours of an entry are found
+by index arithmetic alone and advancing takes O(1) amortized time.
+
+@author		Solomon Colley
+@file		EytzingerIterator.cpp
+@since		10/18/2026
+*/
+
+#include "EytzingerIterator.h"
+
+// -------------------------------------------------------------------------------------
+// Constructor Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+EytzingerIterator<ItemType>::EytzingerIterator() : entriesPtr(nullptr), entryCount(0), index(0)
+{
+} // end default constructor
+
+template<class ItemType>
+EytzingerIterator<ItemType>::EytzingerIterator(const ItemType* entries, std::size_t count,
+	std::size_t entryIndex) : entriesPtr(entries), entryCount(count), index(entryIndex)
+{
+} // end parameterized constructor
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+std::size_t EytzingerIterator<ItemType>::getIndex() const
+{
+	return index;
+} // end getIndex
+
+template<class ItemType>
+std::size_t EytzingerIterator<ItemType>::firstIndex(std::size_t count)
+{
+	if (count == 0)
+		return 0; // end if-else
+
+	std::size_t current = 1;
+	while (2 * current <= count)
+		current = 2 * current; // end while
+	return current;
+} // end firstIndex
+
+template<class ItemType>
+std::size_t EytzingerIterator<ItemType>::lastIndex(std::size_t count)
+{
+	if (count == 0)
+		return 0; // end if-else
+
+	std::size_t current = 1;
+	while (2 * current + 1 <= count)
+		current = 2 * current + 1; // end while
+	return current;
+} // end lastIndex
+
+template<class ItemType>
+std::size_t EytzingerIterator<ItemType>::nextIndex(std::size_t index, std::size_t count)
+{
+	if (2 * index + 1 <= count)
+	{
+		// Go to the leftmost entry of the right subtree.
+		index = 2 * index + 1;
+		while (2 * index <= count)
+			index = 2 * index; // end while
+	}
+	else
+	{
+		// Climb until the current entry is reached from a left child. The
+		// root is a right child of index 0, which ends the climb there.
+		while ((index & 1) != 0)
+			index >>= 1; // end while
+		index >>= 1;
+	} // end if-else
+
+	return index;
+} // end nextIndex
+
+template<class ItemType>
+std::size_t EytzingerIterator<ItemType>::previousIndex(std::size_t index, std::size_t count)
+{
+	if (2 * index <= count)
+	{
+		// Go to the rightmost entry of the left subtree.
+		index = 2 * index;
+		while (2 * index + 1 <= count)
+			index = 2 * index + 1; // end while
+	}
+	else
+	{
+		// Climb until the current entry is reached from a right child.
+		while ((index & 1) == 0)
+			index >>= 1; // end while
+		index >>= 1;
+	} // end if-else
+
+	return index;
+} // end previousIndex
+
+// -------------------------------------------------------------------------------------
+// Overloaded Operator Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+typename EytzingerIterator<ItemType>::reference EytzingerIterator<ItemType>::operator*() const
+{
+	return entriesPtr[index];
+} // end operator*
+
+template<class ItemType>
+typename EytzingerIterator<ItemType>::pointer EytzingerIterator<ItemType>::operator->() const
+{
+	return &entriesPtr[index];
+} // end operator->
+
+template<class ItemType>
+EytzingerIterator<ItemType>& EytzingerIterator<ItemType>::operator++()
+{
+	index = nextIndex(index, entryCount);
+	return *this;
+} // end operator++
+
+template<class ItemType>
+EytzingerIterator<ItemType> EytzingerIterator<ItemType>::operator++(int)
+{
+	EytzingerIterator<ItemType> previous = *this;
+	++(*this);
+	return previous;
+} // end operator++
+
+template<class ItemType>
+EytzingerIterator<ItemType>& EytzingerIterator<ItemType>::operator--()
+{
+	if (index == 0)	// Step back from the end.
+		index = lastIndex(entryCount);
+	else
+		index = previousIndex(index, entryCount); // end if-else
+
+	return *this;
+} // end operator--
+
+template<class ItemType>
+EytzingerIterator<ItemType> EytzingerIterator<ItemType>::operator--(int)
+{
+	EytzingerIterator<ItemType> previous = *this;
+	--(*this);
+	return previous;
+} // end operator--
+
+template<class ItemType>
+bool EytzingerIterator<ItemType>::operator==(const EytzingerIterator<ItemType>& rightHandSide) const
+{
+	return index == rightHandSide.index;
+} // end operator==
+
+template<class ItemType>
+bool EytzingerIterator<ItemType>::operator!=(const EytzingerIterator<ItemType>& rightHandSide) const
+{
+	return index != rightHandSide.index;
+} // end operator!=
@@ -0,0 +1,103 @@
+/**
+This templated class provides a bidirectional iterator that visits the
+data items of a tree stored in Eytzinger order in ascending order. In
+that layout the entry at index k has its children at 2k and 2k + 1 and
+the root is at index 1, so the inorder neighbours of an entry are found
+by index arithmetic alone and advancing takes O(1) amortized time.
+
+@author		Solomon Colley
+@file		EytzingerIterator.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+template<class ItemType>
+class EytzingerIterator
+{
+private:
+	const ItemType* entriesPtr;	// Entries in Eytzinger order, with the root at entriesPtr[1].
+	std::size_t entryCount;		// Number of entries, which occupy indexes 1 to entryCount.
+	std::size_t index;			// Index of the current entry, or 0 at the end.
+
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const ItemType* pointer;
+	typedef const ItemType& reference;
+
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// -------------------------------------------------------------------------------------
+
+	EytzingerIterator();
+	EytzingerIterator(const ItemType* entries, std::size_t count, std::size_t entryIndex);
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Returns the index of the current entry.
+	@return		The index, or 0 at the end.
+	*/
+	std::size_t getIndex() const;
+
+	/**
+	Returns the index of the smallest or largest entry of a tree with
+	count entries.
+	@param		std::size_t count
+	@return		The index, or 0 if count is 0.
+	*/
+	static std::size_t firstIndex(std::size_t count);
+	static std::size_t lastIndex(std::size_t count);
+
+	/**
+	Returns the index of the inorder successor or predecessor of the entry
+	at index in a tree with count entries.
+	@pre		1 <= index <= count.
+	@param		std::size_t index
+	@param		std::size_t count
+	@return		The index, or 0 if there is no such entry.
+	*/
+	static std::size_t nextIndex(std::size_t index, std::size_t count);
+	static std::size_t previousIndex(std::size_t index, std::size_t count);
+
+	// -------------------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Returns the data item at the current position.
+	@pre		The iterator is not at the end.
+	@return		A reference to the current data item.
+	*/
+	reference operator*() const;
+	pointer operator->() const;
+
+	/**
+	Moves this iterator to the next entry in ascending order.
+	@pre		The iterator is not at the end.
+	@return		This iterator, or a copy of it from before the move.
+	*/
+	EytzingerIterator& operator++();
+	EytzingerIterator operator++(int);
+
+	/**
+	Moves this iterator to the previous entry in ascending order, or to
+	the last entry when it is at the end.
+	@pre		The iterator is not at the first entry.
+	@return		This iterator, or a copy of it from before the move.
+	*/
+	EytzingerIterator& operator--();
+	EytzingerIterator operator--(int);
+
+	bool operator==(const EytzingerIterator& rightHandSide) const;
+	bool operator!=(const EytzingerIterator& rightHandSide) const;
+}; // end EytzingerIterator
+
+#include "EytzingerIterator.cpp"
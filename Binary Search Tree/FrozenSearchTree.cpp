@@ -0,0 +1,339 @@
+/**
+This templated class provides an immutable snapshot of a binary search
+tree for read-mostly data. The entries are copied into one contiguous
+array in Eytzinger (breadth-first) order, so the top levels of every
+search share a few cache lines, a search needs no pointers, and the next
+levels can be prefetched while the current one is compared. Searches are
+branchless, with one comparison per level, and batched lookups of int
+keys use AVX2 gathers when the compiler targets AVX2.
+
+@author		Solomon Colley
+@file		FrozenSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "FrozenSearchTree.h"
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class LeftType, class RightType>
+bool FrozenSearchTree<ItemType, Compare>::lessThan(const LeftType& left, const RightType& right) const
+{
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+void FrozenSearchTree<ItemType, Compare>::prepare(std::size_t count, const ItemType& filler)
+{
+	entries.resize(count + 1, filler);
+	entryCount = count;
+} // end prepare
+
+template<class ItemType, class Compare>
+template<class Key>
+std::size_t FrozenSearchTree<ItemType, Compare>::findBoundIndex(const Key& aKey, bool isStrict) const
+{
+	const ItemType* entriesPtr = entries.data();
+	std::uintptr_t entriesAddress = reinterpret_cast<std::uintptr_t>(entriesPtr);
+	std::size_t count = entryCount;
+	std::size_t index = 1;
+
+	while (index <= count)
+	{
+		// The address may lie past the end of the array, which a prefetch
+		// ignores, so it is computed as an integer rather than a pointer.
+		prefetchForRead(reinterpret_cast<const void*>(
+			entriesAddress + index * ENTRIES_PER_LINE * sizeof(ItemType)));
+
+		bool isBefore = isStrict ? !lessThan(aKey, entriesPtr[index])
+			: lessThan(entriesPtr[index], aKey);
+		index = 2 * index + static_cast<std::size_t>(isBefore);
+	} // end while
+
+	return index >> (countTrailingOnes(index) + 1);
+} // end findBoundIndex
+
+template<class ItemType, class Compare>
+template<class Key>
+std::size_t FrozenSearchTree<ItemType, Compare>::findIndex(const Key& aKey) const
+{
+	std::size_t index = findBoundIndex(aKey, false);
+
+	if (index == 0 || lessThan(aKey, entries[index]))
+		return 0;	// The entry was not found.
+	else
+		return index; // end if-else
+} // end findIndex
+
+template<class ItemType, class Compare>
+int FrozenSearchTree<ItemType, Compare>::countTrailingOnes(std::size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(~static_cast<unsigned long long>(value));
+#else
+	int count = 0;
+	for (; (value & 1) != 0; value >>= 1)
+		++count; // end for
+	return count;
+#endif
+} // end countTrailingOnes
+
+#if defined(__AVX2__)
+template<class ItemType, class Compare>
+template<class RandomAccessIterator, class ResultIterator>
+std::size_t FrozenSearchTree<ItemType, Compare>::containsBatchAvx2(RandomAccessIterator first,
+	std::size_t keyCount, ResultIterator& results) const
+{
+	const int* entriesPtr = entries.data();
+
+	// Levels 0 to completeLevels - 1 are full, so every lane can read them
+	// without a mask.
+	int completeLevels = 0;
+	while ((std::size_t(2) << completeLevels) - 1 <= entryCount)
+		++completeLevels; // end while
+	bool hasPartialLevel = (std::size_t(1) << completeLevels) - 1 < entryCount;
+
+	const __m256i limit = _mm256_set1_epi32(static_cast<int>(entryCount + 1));
+	std::size_t position = 0;
+
+	for (; position + 8 <= keyCount; position += 8)
+	{
+		alignas(32) int keyBlock[8];
+		for (int lane = 0; lane < 8; ++lane)
+			keyBlock[lane] = first[position + lane]; // end for
+
+		const __m256i keys = _mm256_load_si256(reinterpret_cast<const __m256i*>(keyBlock));
+		__m256i indexes = _mm256_set1_epi32(1);
+
+		for (int level = 0; level < completeLevels; ++level)
+		{
+			// Each lane moves to 2k, or to 2k + 1 where the entry is less
+			// than its key and the comparison gave -1.
+			__m256i values = _mm256_i32gather_epi32(entriesPtr, indexes, 4);
+			__m256i isBefore = _mm256_cmpgt_epi32(keys, values);
+			indexes = _mm256_sub_epi32(_mm256_add_epi32(indexes, indexes), isBefore);
+		} // end for
+
+		if (hasPartialLevel)
+		{
+			__m256i isInside = _mm256_cmpgt_epi32(limit, indexes);
+			__m256i values = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), entriesPtr, indexes,
+				isInside, 4);
+			__m256i isBefore = _mm256_cmpgt_epi32(keys, values);
+			__m256i stepped = _mm256_sub_epi32(_mm256_add_epi32(indexes, indexes), isBefore);
+			indexes = _mm256_blendv_epi8(indexes, stepped, isInside);
+		} // end if-else
+
+		alignas(32) int indexBlock[8];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(indexBlock), indexes);
+		for (int lane = 0; lane < 8; ++lane)
+		{
+			std::size_t index = static_cast<std::size_t>(indexBlock[lane]);
+			index >>= countTrailingOnes(index) + 1;
+			results[position + lane] = (index != 0 && !(keyBlock[lane] < entriesPtr[index]));
+		} // end for
+	} // end for
+
+	return position;
+} // end containsBatchAvx2
+#endif
+
+// ---------------------------------------------------------------------------
+// Constructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+FrozenSearchTree<ItemType, Compare>::FrozenSearchTree() : entryCount(0), comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+FrozenSearchTree<ItemType, Compare>::FrozenSearchTree(const Compare& treeComparator)
+	: entryCount(0), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool FrozenSearchTree<ItemType, Compare>::isEmpty() const
+{
+	return entryCount == 0;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int FrozenSearchTree<ItemType, Compare>::getHeight() const
+{
+	int height = 0;
+	for (std::size_t levelStart = 1; levelStart <= entryCount; levelStart *= 2)
+		++height; // end for
+	return height;
+} // end getHeight
+
+template<class ItemType, class Compare>
+int FrozenSearchTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return static_cast<int>(entryCount);
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+template<class ForwardIterator>
+void FrozenSearchTree<ItemType, Compare>::assignSorted(ForwardIterator first, ForwardIterator last)
+{
+	std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+	if (count == 0)
+	{
+		entries.clear();
+		entryCount = 0;
+		return;
+	} // end if-else
+
+	prepare(count, *first);
+
+	// Visiting the indexes in inorder pairs them with the sorted entries.
+	std::size_t index = iterator::firstIndex(count);
+	for (; first != last; ++first)
+	{
+		entries[index] = *first;
+		index = iterator::nextIndex(index, count);
+	} // end for
+} // end assignSorted
+
+template<class ItemType, class Compare>
+const ItemType& FrozenSearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	std::size_t index = findIndex(anEntry);
+
+	if (index == 0)
+		throw NotFoundException("The entry does not exist within the frozen search tree.");
+	else
+		return entries[index]; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool FrozenSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	return findIndex(anEntry) != 0;
+} // end contains
+
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+const ItemType& FrozenSearchTree<ItemType, Compare>::getEntry(const Key& aKey) const
+{
+	std::size_t index = findIndex(aKey);
+
+	if (index == 0)
+		throw NotFoundException("The entry does not exist within the frozen search tree.");
+	else
+		return entries[index]; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+bool FrozenSearchTree<ItemType, Compare>::contains(const Key& aKey) const
+{
+	return findIndex(aKey) != 0;
+} // end contains
+
+template<class ItemType, class Compare>
+template<class RandomAccessIterator, class ResultIterator>
+void FrozenSearchTree<ItemType, Compare>::containsBatch(RandomAccessIterator first,
+	RandomAccessIterator last, ResultIterator results) const
+{
+	std::size_t keyCount = static_cast<std::size_t>(last - first);
+	std::size_t position = 0;
+
+#if defined(__AVX2__)
+	if constexpr (std::is_same<ItemType, int>::value
+		&& (std::is_same<Compare, std::less<int>>::value || std::is_same<Compare, std::less<>>::value))
+	{
+		// The gathers take 32-bit indexes, which must stay below 2^31.
+		if (entryCount < (std::size_t(1) << 30))
+			position = containsBatchAvx2(first, keyCount, results); // end if-else
+	} // end if-else
+#endif
+
+	for (; position < keyCount; ++position)
+		results[position] = (findIndex(first[position]) != 0); // end for
+} // end containsBatch
+
+template<class ItemType, class Compare>
+Compare FrozenSearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Range Queries Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::iterator
+FrozenSearchTree<ItemType, Compare>::lowerBound(const ItemType& anEntry) const
+{
+	return iterator(entries.data(), entryCount, findBoundIndex(anEntry, false));
+} // end lowerBound
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::iterator
+FrozenSearchTree<ItemType, Compare>::upperBound(const ItemType& anEntry) const
+{
+	return iterator(entries.data(), entryCount, findBoundIndex(anEntry, true));
+} // end upperBound
+
+template<class ItemType, class Compare>
+std::pair<typename FrozenSearchTree<ItemType, Compare>::iterator,
+	typename FrozenSearchTree<ItemType, Compare>::iterator>
+FrozenSearchTree<ItemType, Compare>::equalRange(const ItemType& anEntry) const
+{
+	return std::make_pair(lowerBound(anEntry), upperBound(anEntry));
+} // end equalRange
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool FrozenSearchTree<ItemType, Compare>::forEachInRange(const ItemType& low, const ItemType& high,
+	Visitor&& visit) const
+{
+	for (std::size_t index = findBoundIndex(low, false);
+		index != 0 && lessThan(entries[index], high);
+		index = iterator::nextIndex(index, entryCount))
+	{
+		if (!applyVisitor(visit, entries[index]))
+			return false; // end if-else
+	} // end for
+
+	return true;
+} // end forEachInRange
+
+// ---------------------------------------------------------------------------
+// Public Iterators Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::iterator FrozenSearchTree<ItemType, Compare>::begin() const
+{
+	return iterator(entries.data(), entryCount, iterator::firstIndex(entryCount));
+} // end begin
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::iterator FrozenSearchTree<ItemType, Compare>::end() const
+{
+	return iterator(entries.data(), entryCount, 0);
+} // end end
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::reverse_iterator FrozenSearchTree<ItemType, Compare>::rbegin() const
+{
+	return reverse_iterator(end());
+} // end rbegin
+
+template<class ItemType, class Compare>
+typename FrozenSearchTree<ItemType, Compare>::reverse_iterator FrozenSearchTree<ItemType, Compare>::rend() const
+{
+	return reverse_iterator(begin());
+} // end rend
@@ -0,0 +1,241 @@
+/**
+This templated class provides an immutable snapshot of a binary search
+tree for read-mostly data. The entries are copied into one contiguous
+array in Eytzinger (breadth-first) order, so the top levels of every
+search share a few cache lines, a search needs no pointers, and the next
+levels can be prefetched while the current one is compared. Searches are
+branchless, with one comparison per level, and batched lookups of int
+keys use AVX2 gathers when the compiler targets AVX2.
+
+@author		Solomon Colley
+@file		FrozenSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "EytzingerIterator.h"
+#include "NotFoundException.h"
+#include "Prefetch.h"
+#include "TreeVisitor.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+template<class ItemType, class Compare>
+class BinarySearchTree;
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class FrozenSearchTree
+{
+private:
+	// Entries per 64-byte cache line. Prefetching entries[k * ENTRIES_PER_LINE]
+	// loads the descendants of entry k that are log2(ENTRIES_PER_LINE) levels
+	// below it.
+	static const std::size_t ENTRIES_PER_LINE = (sizeof(ItemType) < 64) ? 64 / sizeof(ItemType) : 1;
+
+	std::vector<ItemType> entries;	// Entries in Eytzinger order; entries[0] is unused.
+	std::size_t entryCount;			// Number of entries, at indexes 1 to entryCount.
+	Compare comparator;				// Strict weak ordering of the entries.
+
+	// The tree it was frozen from fills in the entries directly.
+	friend class BinarySearchTree<ItemType, Compare>;
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree.
+	@param		const LeftType& left
+	@param		const RightType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	template<class LeftType, class RightType>
+	bool lessThan(const LeftType& left, const RightType& right) const;
+
+	/**
+	Resizes the entry array for count entries without releasing its
+	memory, so that freezing a tree of the same size again allocates
+	nothing. Every new slot is a copy of filler until it is overwritten.
+	@post		The snapshot has room for count entries.
+	@param		std::size_t count
+	@param		const ItemType& filler
+	@return		void
+	*/
+	void prepare(std::size_t count, const ItemType& filler);
+
+	/**
+	Returns the index of the first entry that is not less than aKey, or
+	greater than aKey when isStrict is true. The descent is branchless:
+	each level adds the result of its comparison to the index of the next
+	entry, and the entries four levels down are prefetched on the way.
+	The turns taken after the last left turn are then undone, which
+	leaves the index of the entry where that turn was taken.
+	@param		const Key& aKey
+	@param		bool isStrict
+	@return		The index of the entry, or 0 if every entry is ordered
+					before aKey.
+	*/
+	template<class Key>
+	std::size_t findBoundIndex(const Key& aKey, bool isStrict) const;
+
+	/**
+	Returns the index of the first entry equivalent to aKey.
+	@param		const Key& aKey
+	@return		The index of the entry, or 0 if there is none.
+	*/
+	template<class Key>
+	std::size_t findIndex(const Key& aKey) const;
+
+	/**
+	Returns the number of trailing 1 bits of value.
+	@param		std::size_t value
+	@return		The number of consecutive 1 bits starting at bit 0.
+	*/
+	static int countTrailingOnes(std::size_t value);
+
+#if defined(__AVX2__)
+	/**
+	Looks up the keys in eight lanes at a time with AVX2 gathers, storing
+	the results as containsBatch does. Every lane descends the complete
+	levels in lockstep, and a masked gather handles the last, partial
+	level.
+	@pre		ItemType is int, the tree is ordered by operator<, and it
+					holds fewer than 2^30 entries.
+	@param		RandomAccessIterator first
+	@param		std::size_t keyCount
+	@param		ResultIterator& results
+	@return		The number of keys looked up, a multiple of 8.
+	*/
+	template<class RandomAccessIterator, class ResultIterator>
+	std::size_t containsBatchAvx2(RandomAccessIterator first, std::size_t keyCount,
+		ResultIterator& results) const;
+#endif
+
+public:
+	typedef EytzingerIterator<ItemType> iterator;
+	typedef EytzingerIterator<ItemType> const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	// ---------------------------------------------------------------------------
+	// Constructor Section.
+	// A snapshot owns a copy of its entries, so it is copied and moved like a
+	// vector and stays valid after the tree it was frozen from changes.
+	// ---------------------------------------------------------------------------
+
+	FrozenSearchTree();
+	explicit FrozenSearchTree(const Compare& treeComparator);
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+	int getHeight() const;
+	int getNumberOfNodes() const;
+
+	/**
+	Replaces the entries of this snapshot with the entries in the range
+	[first, last), which must already be in ascending order. Each entry
+	is copied once, straight to its final position, in O(n) time.
+	@pre		The range is sorted in ascending order. Duplicates are
+					allowed.
+	@post		The snapshot holds exactly the entries of the range.
+	@param		ForwardIterator first
+	@param		ForwardIterator last
+	@return		void
+	*/
+	template<class ForwardIterator>
+	void assignSorted(ForwardIterator first, ForwardIterator last);
+
+	/**
+	Returns the first entry equivalent to anEntry, or whether one occurs
+	in the snapshot, as the methods of BinarySearchTree do.
+	@param		const ItemType& anEntry
+	@return		A reference to the entry, or whether it was found.
+	@throws		NotFoundException if getEntry finds no such entry.
+	*/
+	const ItemType& getEntry(const ItemType& anEntry) const;
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Heterogeneous versions of getEntry and contains, only available when
+	Compare declares is_transparent. See BinarySearchTree.
+	@param		const Key& aKey
+	@return		A reference to the entry, or whether it was found.
+	@throws		NotFoundException if getEntry finds no such entry.
+	*/
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	const ItemType& getEntry(const Key& aKey) const;
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	bool contains(const Key& aKey) const;
+
+	/**
+	Looks up every key in the range [first, last) and stores whether it
+	occurs in this snapshot, in the same order as the keys. A snapshot of
+	int ordered by std::less uses AVX2 when it is available; other types
+	run the scalar search once per key.
+	@pre		results refers to at least last - first writable elements.
+	@post		results[i] is true if first[i] occurs in the snapshot, or
+					false if not.
+	@param		RandomAccessIterator first
+	@param		RandomAccessIterator last
+	@param		ResultIterator results
+	@return		void
+	*/
+	template<class RandomAccessIterator, class ResultIterator>
+	void containsBatch(RandomAccessIterator first, RandomAccessIterator last,
+		ResultIterator results) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries.
+	@return		The comparator of this snapshot.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Range Queries Section.
+	// These behave as the range queries of BinarySearchTree do, in
+	// O(log n + k) time for k results.
+	// ---------------------------------------------------------------------------
+
+	iterator lowerBound(const ItemType& anEntry) const;
+	iterator upperBound(const ItemType& anEntry) const;
+	std::pair<iterator, iterator> equalRange(const ItemType& anEntry) const;
+
+	/**
+	Calls visit in ascending order with a constant reference to each entry
+	that is not less than low and less than high. If visit returns a
+	value, the visitation stops as soon as that value is false.
+	@param		const ItemType& low
+	@param		const ItemType& high
+	@param		Visitor&& visit
+	@return		True if every entry in the range was visited, or false if
+					visit stopped the visitation.
+	*/
+	template<class Visitor>
+	bool forEachInRange(const ItemType& low, const ItemType& high, Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Iterators Section.
+	// The iterators visit the entries in ascending order.
+	// ---------------------------------------------------------------------------
+
+	iterator begin() const;
+	iterator end() const;
+	reverse_iterator rbegin() const;
+	reverse_iterator rend() const;
+}; // end FrozenSearchTree
+
+#include "FrozenSearchTree.cpp"
@@ -0,0 +1,313 @@
+/**
+This templated class provides a lock-free binary search tree for many
+threads that add and remove entries at once, following the algorithm of
+Natarajan and Mittal (PPoPP 2014). The tree is external: the entries are
+held by the leaves and every internal node only routes searches. A
+removal first flags the edge to its leaf, so that the leaf cannot change,
+and then tags the edge to the sibling of that leaf and swings one edge
+higher up past both. Any thread that finds a flagged or tagged edge in
+its way helps to finish that removal, so no thread ever waits for
+another. Unlinked nodes are retired to the EpochManager.
+
+@author		Solomon Colley
+@file		LockFreeSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "LockFreeSearchTree.h"
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+LockFreeSearchTree<ItemType, Compare>::Node::Node(const ItemType& anItem, int infinityRank,
+	Node* leftPtr, Node* rightPtr) : item(anItem), infinity(infinityRank),
+	leftEdge(reinterpret_cast<std::uintptr_t>(leftPtr)), rightEdge(reinterpret_cast<std::uintptr_t>(rightPtr))
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+typename LockFreeSearchTree<ItemType, Compare>::Node*
+LockFreeSearchTree<ItemType, Compare>::getAddress(std::uintptr_t edge)
+{
+	return reinterpret_cast<Node*>(edge & ~MARK_BITS);
+} // end getAddress
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::isFlagged(std::uintptr_t edge)
+{
+	return (edge & FLAG_BIT) != 0;
+} // end isFlagged
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::isTagged(std::uintptr_t edge)
+{
+	return (edge & TAG_BIT) != 0;
+} // end isTagged
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::isBefore(const ItemType& aKey, const Node* nodePtr) const
+{
+	return nodePtr->infinity != 0 || comparator(aKey, nodePtr->item);
+} // end isBefore
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::isEquivalent(const ItemType& aKey, const Node* leafPtr) const
+{
+	return leafPtr->infinity == 0 && !comparator(aKey, leafPtr->item) && !comparator(leafPtr->item, aKey);
+} // end isEquivalent
+
+template<class ItemType, class Compare>
+std::atomic<std::uintptr_t>& LockFreeSearchTree<ItemType, Compare>::getEdgeToward(Node* nodePtr,
+	const ItemType& aKey) const
+{
+	if (isBefore(aKey, nodePtr))
+		return nodePtr->leftEdge;
+	else
+		return nodePtr->rightEdge; // end if-else
+} // end getEdgeToward
+
+template<class ItemType, class Compare>
+void LockFreeSearchTree<ItemType, Compare>::seek(const ItemType& aKey, SeekRecord& record) const
+{
+	Node* sentinelPtr = getAddress(rootPtr->leftEdge.load(std::memory_order_acquire));
+
+	record.ancestorPtr = rootPtr;
+	record.successorPtr = sentinelPtr;
+	record.parentPtr = sentinelPtr;
+	record.leafPtr = getAddress(sentinelPtr->leftEdge.load(std::memory_order_acquire));
+
+	std::uintptr_t parentEdge = sentinelPtr->leftEdge.load(std::memory_order_acquire);
+	std::uintptr_t currentEdge = record.leafPtr->leftEdge.load(std::memory_order_acquire);
+	Node* currentPtr = getAddress(currentEdge);
+
+	while (currentPtr != nullptr)
+	{
+		// The part of the path a removal would unlink starts below the last
+		// edge that is not tagged.
+		if (!isTagged(parentEdge))
+		{
+			record.ancestorPtr = record.parentPtr;
+			record.successorPtr = record.leafPtr;
+		} // end if-else
+
+		record.parentPtr = record.leafPtr;
+		record.leafPtr = currentPtr;
+		parentEdge = currentEdge;
+
+		currentEdge = getEdgeToward(currentPtr, aKey).load(std::memory_order_acquire);
+		currentPtr = getAddress(currentEdge);
+	} // end while
+} // end seek
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::cleanup(const ItemType& aKey, const SeekRecord& record)
+{
+	Node* parentPtr = record.parentPtr;
+	std::atomic<std::uintptr_t>& successorEdge = getEdgeToward(record.ancestorPtr, aKey);
+
+	std::atomic<std::uintptr_t>* childEdgePtr = &parentPtr->leftEdge;
+	std::atomic<std::uintptr_t>* siblingEdgePtr = &parentPtr->rightEdge;
+	if (!isBefore(aKey, parentPtr))
+		std::swap(childEdgePtr, siblingEdgePtr); // end if-else
+
+	// When the edge toward the key is not the flagged one, this call helps
+	// to remove the leaf on the other side, and the child toward the key is
+	// the one that moves up.
+	if (!isFlagged(childEdgePtr->load(std::memory_order_acquire)))
+		std::swap(childEdgePtr, siblingEdgePtr); // end if-else
+
+	// Freezes the edge to the sibling, then moves the sibling up, keeping
+	// its flag so that a removal of the sibling itself carries on.
+	siblingEdgePtr->fetch_or(TAG_BIT);
+	std::uintptr_t siblingEdge = siblingEdgePtr->load(std::memory_order_acquire) & ~TAG_BIT;
+
+	std::uintptr_t expectedEdge = reinterpret_cast<std::uintptr_t>(record.successorPtr);
+	if (!successorEdge.compare_exchange_strong(expectedEdge, siblingEdge))
+		return false; // end if-else
+
+	// The nodes from the successor down to the parent are now unreachable,
+	// together with the flagged leaf beside each of them.
+	Node* currentPtr = record.successorPtr;
+	while (currentPtr != parentPtr)
+	{
+		std::atomic<std::uintptr_t>& pathEdge = getEdgeToward(currentPtr, aKey);
+		std::atomic<std::uintptr_t>& otherEdge = (&pathEdge == &currentPtr->leftEdge)
+			? currentPtr->rightEdge : currentPtr->leftEdge;
+
+		Node* nextPtr = getAddress(pathEdge.load(std::memory_order_acquire));
+		EpochManager::retire(getAddress(otherEdge.load(std::memory_order_acquire)));
+		EpochManager::retire(currentPtr);
+		currentPtr = nextPtr;
+	} // end while
+
+	EpochManager::retire(getAddress(childEdgePtr->load(std::memory_order_acquire)));
+	EpochManager::retire(parentPtr);
+	return true;
+} // end cleanup
+
+template<class ItemType, class Compare>
+void LockFreeSearchTree<ItemType, Compare>::destroyTree(Node* subTreePtr)
+{
+	std::vector<Node*> pendingPtrs;
+	if (subTreePtr != nullptr)
+		pendingPtrs.push_back(subTreePtr); // end if-else
+
+	while (!pendingPtrs.empty())
+	{
+		Node* nodePtr = pendingPtrs.back();
+		pendingPtrs.pop_back();
+
+		Node* leftPtr = getAddress(nodePtr->leftEdge.load(std::memory_order_relaxed));
+		Node* rightPtr = getAddress(nodePtr->rightEdge.load(std::memory_order_relaxed));
+		if (leftPtr != nullptr)
+		{
+			pendingPtrs.push_back(leftPtr);
+			pendingPtrs.push_back(rightPtr);
+		} // end if-else
+		delete nodePtr;
+	} // end while
+} // end destroyTree
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+LockFreeSearchTree<ItemType, Compare>::LockFreeSearchTree() : LockFreeSearchTree(Compare())
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+LockFreeSearchTree<ItemType, Compare>::LockFreeSearchTree(const Compare& treeComparator)
+	: rootPtr(nullptr), comparator(treeComparator)
+{
+	// The sentinel keys rank 1 < 2 < 3, after every real key.
+	Node* sentinelPtr = new Node(ItemType(), 2, new Node(ItemType(), 1, nullptr, nullptr),
+		new Node(ItemType(), 2, nullptr, nullptr));
+	rootPtr = new Node(ItemType(), 3, sentinelPtr, new Node(ItemType(), 3, nullptr, nullptr));
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+LockFreeSearchTree<ItemType, Compare>::~LockFreeSearchTree()
+{
+	destroyTree(rootPtr);
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::isEmpty() const
+{
+	EpochGuard guard;
+
+	// Without entries, the left child of the second sentinel is the leaf
+	// with the smallest sentinel key.
+	Node* sentinelPtr = getAddress(rootPtr->leftEdge.load(std::memory_order_acquire));
+	Node* leftPtr = getAddress(sentinelPtr->leftEdge.load(std::memory_order_acquire));
+	return getAddress(leftPtr->leftEdge.load(std::memory_order_acquire)) == nullptr;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	EpochGuard guard;
+	SeekRecord record;
+	Node* newLeafPtr = nullptr;
+	Node* newInternalPtr = nullptr;
+
+	while (true)
+	{
+		seek(newEntry, record);
+		Node* leafPtr = record.leafPtr;
+
+		if (isEquivalent(newEntry, leafPtr))
+		{
+			delete newLeafPtr;
+			delete newInternalPtr;
+			return false;
+		} // end if-else
+
+		if (newLeafPtr == nullptr)
+			newLeafPtr = new Node(newEntry, 0, nullptr, nullptr); // end if-else
+
+		// The new internal node takes the larger key of the two leaves.
+		delete newInternalPtr;
+		newInternalPtr = nullptr;
+		if (isBefore(newEntry, leafPtr))
+			newInternalPtr = new Node(leafPtr->item, leafPtr->infinity, newLeafPtr, leafPtr);
+		else
+			newInternalPtr = new Node(newEntry, 0, leafPtr, newLeafPtr); // end if-else
+
+		std::atomic<std::uintptr_t>& childEdge = getEdgeToward(record.parentPtr, newEntry);
+		std::uintptr_t expectedEdge = reinterpret_cast<std::uintptr_t>(leafPtr);
+		if (childEdge.compare_exchange_strong(expectedEdge, reinterpret_cast<std::uintptr_t>(newInternalPtr)))
+			return true; // end if-else
+
+		// Helps a removal that holds the edge, then tries again.
+		if (getAddress(expectedEdge) == leafPtr && (expectedEdge & MARK_BITS) != 0)
+			cleanup(newEntry, record); // end if-else
+	} // end while
+} // end add
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::remove(const ItemType& anEntry)
+{
+	EpochGuard guard;
+	SeekRecord record;
+	Node* leafPtr = nullptr;	// The flagged leaf, once the removal has been injected.
+
+	while (true)
+	{
+		seek(anEntry, record);
+
+		if (leafPtr == nullptr)
+		{
+			// Injection: flag the edge to the leaf, which decides the removal.
+			if (!isEquivalent(anEntry, record.leafPtr))
+				return false; // end if-else
+
+			std::atomic<std::uintptr_t>& childEdge = getEdgeToward(record.parentPtr, anEntry);
+			std::uintptr_t expectedEdge = reinterpret_cast<std::uintptr_t>(record.leafPtr);
+			if (childEdge.compare_exchange_strong(expectedEdge, expectedEdge | FLAG_BIT))
+			{
+				leafPtr = record.leafPtr;
+				if (cleanup(anEntry, record))
+					return true; // end if-else
+			}
+			else if (getAddress(expectedEdge) == record.leafPtr && (expectedEdge & MARK_BITS) != 0)
+				cleanup(anEntry, record); // end if-else
+		}
+		else
+		{
+			// Cleanup: unlink the flagged leaf unless a helper already did.
+			if (record.leafPtr != leafPtr || cleanup(anEntry, record))
+				return true; // end if-else
+		} // end if-else
+	} // end while
+} // end remove
+
+template<class ItemType, class Compare>
+bool LockFreeSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	EpochGuard guard;
+
+	Node* currentPtr = getAddress(rootPtr->leftEdge.load(std::memory_order_acquire));
+	Node* nextPtr = getAddress(getEdgeToward(currentPtr, anEntry).load(std::memory_order_acquire));
+	while (nextPtr != nullptr)
+	{
+		currentPtr = nextPtr;
+		nextPtr = getAddress(getEdgeToward(currentPtr, anEntry).load(std::memory_order_acquire));
+	} // end while
+
+	return isEquivalent(anEntry, currentPtr);
+} // end contains
+
+template<class ItemType, class Compare>
+Compare LockFreeSearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
@@ -0,0 +1,197 @@
+/**
+This templated class provides a lock-free binary search tree for many
+threads that add and remove entries at once, following the algorithm of
+Natarajan and Mittal (PPoPP 2014). The tree is external: the entries are
+held by the leaves and every internal node only routes searches. A
+removal first flags the edge to its leaf, so that the leaf cannot change,
+and then tags the edge to the sibling of that leaf and swings one edge
+higher up past both. Any thread that finds a flagged or tagged edge in
+its way helps to finish that removal, so no thread ever waits for
+another. Unlinked nodes are retired to the EpochManager.
+
+The entries form a set: an entry equivalent to one already in the tree
+is not added again. Every operation is linearizable.
+
+@author		Solomon Colley
+@file		LockFreeSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "EpochManager.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class LockFreeSearchTree
+{
+private:
+	// The edges are node addresses whose two lowest bits mark them.
+	static const std::uintptr_t FLAG_BIT = 1;	// The leaf below the edge is being removed.
+	static const std::uintptr_t TAG_BIT = 2;	// The edge is frozen while its sibling is removed.
+	static const std::uintptr_t MARK_BITS = FLAG_BIT | TAG_BIT;
+
+	/**
+	A node of the tree. A leaf has no children; an internal node always
+	has two, and the entries less than its key are in its left subtree.
+	*/
+	struct Node
+	{
+		ItemType item;							// Key of the node.
+		int infinity;							// 0 for a real key, or 1 to 3 for the sentinel keys.
+		std::atomic<std::uintptr_t> leftEdge;	// Marked address of the left child.
+		std::atomic<std::uintptr_t> rightEdge;	// Marked address of the right child.
+
+		Node(const ItemType& anItem, int infinityRank, Node* leftPtr, Node* rightPtr);
+	}; // end Node
+
+	/**
+	The end of the path to a key and the edge above it that a removal
+	swings. The edges from successorPtr down to parentPtr are all tagged.
+	*/
+	struct SeekRecord
+	{
+		Node* ancestorPtr;		// Node whose edge to successorPtr is the last untagged one.
+		Node* successorPtr;		// Top of the part of the path a removal unlinks.
+		Node* parentPtr;		// Parent of leafPtr.
+		Node* leafPtr;			// Leaf the search for the key ends at.
+	}; // end SeekRecord
+
+	// Sentinel root with the largest key. Its left child is a sentinel with
+	// the second largest key, so every real key is in the left subtree of
+	// that node and the root and its child are never removed.
+	Node* rootPtr;
+	Compare comparator;		// Strict weak ordering of the entries.
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns the node an edge points to, or the flag or tag of the edge.
+	@param		std::uintptr_t edge
+	@return		The address without its marks, or whether the bit is set.
+	*/
+	static Node* getAddress(std::uintptr_t edge);
+	static bool isFlagged(std::uintptr_t edge);
+	static bool isTagged(std::uintptr_t edge);
+
+	/**
+	Returns whether aKey is ordered before the key of nodePtr. Every real
+	key is ordered before the sentinel keys.
+	@param		const ItemType& aKey
+	@param		const Node* nodePtr
+	@return		True if aKey comes before the key of the node, or false if
+					not.
+	*/
+	bool isBefore(const ItemType& aKey, const Node* nodePtr) const;
+
+	/**
+	Returns whether the leaf holds a key equivalent to aKey.
+	@param		const ItemType& aKey
+	@param		const Node* leafPtr
+	@return		True if the keys are equivalent, or false if not.
+	*/
+	bool isEquivalent(const ItemType& aKey, const Node* leafPtr) const;
+
+	/**
+	Returns the edge of nodePtr that a search for aKey follows.
+	@param		Node* nodePtr
+	@param		const ItemType& aKey
+	@return		A reference to the left or right edge of the node.
+	*/
+	std::atomic<std::uintptr_t>& getEdgeToward(Node* nodePtr, const ItemType& aKey) const;
+
+	/**
+	Searches for aKey and records the end of its path.
+	@pre		The caller holds an EpochGuard.
+	@param		const ItemType& aKey
+	@param		SeekRecord& record
+	@return		void
+	*/
+	void seek(const ItemType& aKey, SeekRecord& record) const;
+
+	/**
+	Finishes the removal of a flagged leaf below the parent of the record
+	by tagging the edge to its sibling and swinging the edge from the
+	ancestor to the sibling. The thread whose swing succeeds retires the
+	unlinked nodes.
+	@pre		The caller holds an EpochGuard, and an edge of the parent
+					in the record is flagged.
+	@param		const ItemType& aKey
+	@param		const SeekRecord& record
+	@return		True if this call unlinked the leaf, or false if the edge
+					from the ancestor had changed.
+	*/
+	bool cleanup(const ItemType& aKey, const SeekRecord& record);
+
+	/**
+	Deletes every node of a tree that no other thread can reach.
+	@param		Node* subTreePtr
+	@return		void
+	*/
+	static void destroyTree(Node* subTreePtr);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	LockFreeSearchTree();
+	explicit LockFreeSearchTree(const Compare& treeComparator);
+
+	/**
+	Deletes every node.
+	@pre		No other thread is using the tree.
+	*/
+	virtual ~LockFreeSearchTree();
+
+	LockFreeSearchTree(const LockFreeSearchTree<ItemType, Compare>& tree) = delete;
+	LockFreeSearchTree& operator=(const LockFreeSearchTree<ItemType, Compare>& rightHandSide) = delete;
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// Every method may be called by any number of threads at once, and none
+	// of them takes a lock. The ItemType must be default constructible, for
+	// the sentinel nodes.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+
+	/**
+	Adds a new entry unless an equivalent entry is already in the tree.
+	@post		The tree holds an entry equivalent to newEntry.
+	@param		const ItemType& newEntry
+	@return		True if the entry was added, or false if an equivalent
+					entry was already present.
+	*/
+	bool add(const ItemType& newEntry);
+
+	/**
+	Removes the entry equivalent to anEntry.
+	@post		The tree holds no entry equivalent to anEntry.
+	@param		const ItemType& anEntry
+	@return		True if this call removed the entry, or false if there was
+					none.
+	*/
+	bool remove(const ItemType& anEntry);
+
+	/**
+	Returns whether an entry equivalent to anEntry occurs in the tree.
+	@param		const ItemType& anEntry
+	@return		True if the entry was found, or false if not.
+	*/
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries of this tree.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+}; // end LockFreeSearchTree
+
+#include "LockFreeSearchTree.cpp"
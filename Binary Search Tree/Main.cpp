@@ -8,9 +8,16 @@ and its dependencies provide users with a full implementation of BSTs.
 @since		04/22/2019
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <random>
+#include <vector>
 #include "BinarySearchTree.h"	// BST ADT
+#include "AVLTree.h"			// Self-balancing BST
+#include "FrozenSearchTree.h"	// Read-only snapshot of a BST
+#include "MultisetSearchTree.h"	// BST that counts duplicates in one node
 
 using namespace std;
 
@@ -25,14 +32,6 @@ Displays the current entry being visited in the BST.
 */
 void display(int& anEntry);
 
-/**
-Finds and displays a specific node's value in the BST given
-its position by traversing the BST and visiting each node.
-@param		int& anEntry
-@return		void
-*/
-void searchByPosUtility(int& anEntry);
-
 /**
 Finds and displays a specific node's value in the BST given
 its value by traversing the BST and visiting each node.
@@ -131,21 +130,89 @@ int main()
 	index = 1;
 
 	cout << "\nSearching for the entry at position " << 13 << " in the BST ~\n\n";
-	parameter = 13;
-	bstPtr->preorderTraverse(searchByPosUtility);
-	index = 1;
+	int position = 0;
+	bstPtr->preorderTraverse([&position](const int& anEntry)
+	{
+		if (++position == 13)
+			cout << "Entry " << anEntry << " is at position " << position << ".\n"; // end if-else
+		return position < 13;	// Stop the traversal once the position is reached.
+	});
 
 	cout << "\nTraversing and displaying the BST inorder ~\n\n";
 	bstPtr->inorderTraverse(display);
 	index = 1;
 
+	cout << "\nSearching the BST with iterators ~\n\n";
+	BinarySearchTree<int>::iterator found = find_if(bstPtr->begin(), bstPtr->end(),
+		[](const int& anEntry) { return anEntry > 50; });
+	if (found != bstPtr->end())
+		cout << "The first entry greater than 50 is " << *found << ".\n";
+	else
+		cout << "No entry is greater than 50.\n"; // end if-else
+	cout << "The smallest entry is " << *bstPtr->begin()
+		<< " and the largest entry is " << *bstPtr->rbegin() << ".\n";
+
+	cout << "\nQuerying the BST by rank ~\n\n";
+	int entries = bstPtr->getNumberOfNodes();
+	cout << "The 13th smallest entry is " << bstPtr->select(12) << ".\n"
+		<< "The median entry is " << bstPtr->select(entries / 2)
+		<< " and the 99th percentile entry is " << bstPtr->select(entries * 99 / 100) << ".\n"
+		<< bstPtr->rank(0) << " entries are less than 0.\n";
+
+	cout << "\nVisiting the entries in the range [0, 25) ~\n\n";
+	bstPtr->forEachInRange(0, 25, [](const int& anEntry) { cout << anEntry << ", "; });
+	pair<BinarySearchTree<int>::iterator, BinarySearchTree<int>::iterator> equalEntries =
+		bstPtr->equalRange(*bstPtr->begin());
+	cout << "\nThe smallest entry occurs " << distance(equalEntries.first, equalEntries.second)
+		<< " time(s).\n";
+
+	cout << "\nCounting the same 100 random integers in a multiset ~\n\n";
+	MultisetSearchTree<int> multiset(randInts, randInts + 100);
+	cout << "The multiset holds " << multiset.getNumberOfEntries() << " entries in "
+		<< multiset.getNumberOfNodes() << " nodes and has a height of " << multiset.getHeight() << ".\n"
+		<< "The 100th entry (" << randInts[99] << ") occurs " << multiset.count(randInts[99])
+		<< " time(s).\n";
+
 	cout << "\nFreeing allocated memory and destroying the BST ~\n";
 	delete[] randInts;
 	bstPtr->clear();
-	bstPtr->~BinarySearchTree();
 	delete bstPtr;
 	bstPtr = nullptr;
 
+	cout << "\nComparing the heights of trees built from sorted entries ~\n\n";
+	BinarySearchTree<int> sortedBst;
+	for (int i = 0; i < 1000; ++i)
+		sortedBst.add(i); // end for
+	cout << "A BST built from 1000 sorted entries has a height of "
+		<< sortedBst.getHeight() << ".\n";
+
+	const int avlEntries = 1000000;
+	AVLTree<int> sortedAvl;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int i = 0; i < avlEntries; ++i)
+		sortedAvl.add(i); // end for
+	chrono::milliseconds elapsed = chrono::duration_cast<chrono::milliseconds>(
+		chrono::steady_clock::now() - start);
+	cout << "An AVL tree built from " << avlEntries << " sorted entries has a height of "
+		<< sortedAvl.getHeight() << " (log2(n) = " << log2(avlEntries) << ") and took "
+		<< elapsed.count() << " ms to build.\n";
+
+	vector<int> sortedEntries(10000000);
+	for (int i = 0; i < static_cast<int>(sortedEntries.size()); ++i)
+		sortedEntries[i] = i; // end for
+	BinarySearchTree<int> bulkBst;
+	start = chrono::steady_clock::now();
+	bulkBst.assignSorted(sortedEntries.begin(), sortedEntries.end());
+	elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+	cout << "A BST bulk loaded from " << sortedEntries.size() << " sorted entries has a height of "
+		<< bulkBst.getHeight() << " and took " << elapsed.count() << " ms to build.\n";
+
+	start = chrono::steady_clock::now();
+	FrozenSearchTree<int> frozenBst = bulkBst.freeze();
+	elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+	cout << "Freezing it into a read-only snapshot took " << elapsed.count() << " ms, and the snapshot "
+		<< (frozenBst.contains(1234567) ? "contains" : "does not contain") << " 1234567.\n\n";
+
 	cout << "Enter any character to exit: ";
 	cin.get();
 
@@ -160,13 +227,6 @@ void display(int& anEntry)
 		cout << "\n";
 } // end display
 
-void searchByPosUtility(int& anEntry)
-{
-	if (parameter == index)
-		cout << "Entry " << anEntry << " is at position " << index << ".\n";
-	++index;
-} // end searchByPosUtility
-
 void searchByValUtility(int& anEntry)
 {
 	if (parameter == anEntry)
@@ -0,0 +1,168 @@
+/**
+This class maps a whole file into memory for reading. The pages are
+loaded by the operating system the first time they are read and are
+shared with every other process that maps the same file, so opening a
+file takes the same time whatever its size. The mapping is released
+when the object is destroyed or closed.
+
+@author		Solomon Colley
+@file		MappedFile.cpp
+@since		10/18/2026
+*/
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+// -------------------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// -------------------------------------------------------------------------------------
+
+MappedFile::MappedFile()
+	: data(nullptr), size(0)
+{
+} // end default constructor
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& fileName)
+	: data(nullptr), size(0)
+{
+	HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize))
+	{
+		CloseHandle(fileHandle);
+		throw SerializationException("The size of the file " + fileName + " could not be read.");
+	} // end if-else
+
+	// A file of no bytes cannot be mapped, and there is nothing to map.
+	if (fileSize.QuadPart > 0)
+	{
+		HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void* viewPtr = (mappingHandle != nullptr)
+			? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+		// The view keeps the mapping open after both handles are closed.
+		if (mappingHandle != nullptr)
+			CloseHandle(mappingHandle); // end if-else
+		CloseHandle(fileHandle);
+
+		if (viewPtr == nullptr)
+			throw SerializationException("The file " + fileName + " could not be mapped."); // end if-else
+
+		data = static_cast<const char*>(viewPtr);
+		size = static_cast<std::size_t>(fileSize.QuadPart);
+	}
+	else
+		CloseHandle(fileHandle); // end if-else
+} // end parameterized constructor
+
+#else
+
+MappedFile::MappedFile(const std::string& fileName)
+	: data(nullptr), size(0)
+{
+	int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+	if (fileDescriptor < 0)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	struct stat fileStatus;
+	if (fstat(fileDescriptor, &fileStatus) != 0)
+	{
+		::close(fileDescriptor);
+		throw SerializationException("The size of the file " + fileName + " could not be read.");
+	} // end if-else
+
+	// A file of no bytes cannot be mapped, and there is nothing to map.
+	if (fileStatus.st_size > 0)
+	{
+		std::size_t fileSize = static_cast<std::size_t>(fileStatus.st_size);
+		void* viewPtr = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+
+		// The mapping stays valid after the file is closed.
+		::close(fileDescriptor);
+		if (viewPtr == MAP_FAILED)
+			throw SerializationException("The file " + fileName + " could not be mapped."); // end if-else
+
+		data = static_cast<const char*>(viewPtr);
+		size = fileSize;
+	}
+	else
+		::close(fileDescriptor); // end if-else
+} // end parameterized constructor
+
+#endif
+
+MappedFile::MappedFile(MappedFile&& file)
+	: data(file.data), size(file.size)
+{
+	file.data = nullptr;
+	file.size = 0;
+} // end move constructor
+
+MappedFile::~MappedFile()
+{
+	close();
+} // end destructor
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+void MappedFile::close()
+{
+	if (data != nullptr)
+	{
+#if defined(_WIN32)
+		UnmapViewOfFile(data);
+#else
+		munmap(const_cast<char*>(data), size);
+#endif
+	} // end if-else
+
+	data = nullptr;
+	size = 0;
+} // end close
+
+const char* MappedFile::getData() const
+{
+	return data;
+} // end getData
+
+std::size_t MappedFile::getSize() const
+{
+	return size;
+} // end getSize
+
+// -------------------------------------------------------------------------------------
+// Overloaded Operator Section.
+// -------------------------------------------------------------------------------------
+
+MappedFile& MappedFile::operator=(MappedFile&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		close();
+		std::swap(data, rightHandSide.data);
+		std::swap(size, rightHandSide.size);
+	} // end if-else
+
+	return *this;
+} // end operator=
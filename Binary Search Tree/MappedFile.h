@@ -0,0 +1,77 @@
+/**
+This class maps a whole file into memory for reading. The pages are
+loaded by the operating system the first time they are read and are
+shared with every other process that maps the same file, so opening a
+file takes the same time whatever its size. The mapping is released
+when the object is destroyed or closed.
+
+@author		Solomon Colley
+@file		MappedFile.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "SerializationException.h"
+
+class MappedFile
+{
+private:
+	const char* data;	// First byte of the mapped file, or nullptr if none is mapped.
+	std::size_t size;	// Number of bytes mapped.
+
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// A mapping is moved but never copied.
+	// -------------------------------------------------------------------------------------
+
+	MappedFile();
+
+	/**
+	Maps the named file.
+	@param		const std::string& fileName
+	@throws		SerializationException if the file cannot be opened or
+					mapped.
+	*/
+	explicit MappedFile(const std::string& fileName);
+
+	MappedFile(MappedFile&& file);
+	MappedFile(const MappedFile& file) = delete;
+
+	~MappedFile();
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Releases the mapping, if there is one.
+	@post		No file is mapped.
+	@return		void
+	*/
+	void close();
+
+	/**
+	Returns the first byte of the mapped file. The address is aligned to
+	a page of memory.
+	@return		A pointer to the bytes, or nullptr if no file is mapped or
+					the file is empty.
+	*/
+	const char* getData() const;
+
+	/**
+	Returns the size of the mapped file.
+	@return		The number of bytes, or 0 if no file is mapped.
+	*/
+	std::size_t getSize() const;
+
+	// -------------------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// -------------------------------------------------------------------------------------
+
+	MappedFile& operator=(MappedFile&& rightHandSide);
+	MappedFile& operator=(const MappedFile& rightHandSide) = delete;
+}; // end MappedFile
@@ -0,0 +1,498 @@
+/**
+This templated class provides a read-only binary search tree that is
+used straight from a memory-mapped file. The file holds the nodes of a
+perfectly balanced tree in ascending order, and each node links to its
+children by their distance from it in nodes instead of by pointers, so
+the same bytes are a valid tree wherever the file is mapped. Opening a
+tree only maps the file and checks its header, which takes the same
+time for any size. The pages are read in on first use and shared with
+every process that opens the same file.
+
+@author		Solomon Colley
+@file		MappedSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "MappedSearchTree.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::lessThan(const ItemType& left, const ItemType& right) const
+{
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+std::size_t MappedSearchTree<ItemType, Compare>::findBoundIndex(const ItemType& anEntry, bool isStrict) const
+{
+	std::size_t boundIndex = nodeCount;
+	if (nodeCount == 0)
+		return boundIndex; // end if-else
+
+	const Node* nodePtr = nodesPtr + rootIndex;
+	while (true)
+	{
+		// Both children are fetched while this node is compared, so the
+		// next level is on its way whichever side the search takes.
+		prefetchForRead(nodePtr + nodePtr->leftOffset);
+		prefetchForRead(nodePtr + nodePtr->rightOffset);
+
+		bool isBefore = isStrict ? !lessThan(anEntry, nodePtr->item)
+			: lessThan(nodePtr->item, anEntry);
+		std::int32_t offset;
+
+		if (isBefore)
+			offset = nodePtr->rightOffset;
+		else
+		{
+			boundIndex = static_cast<std::size_t>(nodePtr - nodesPtr);
+			offset = nodePtr->leftOffset;
+		} // end if-else
+
+		if (offset == 0)
+			return boundIndex; // end if-else
+		nodePtr += offset;
+	} // end while
+} // end findBoundIndex
+
+template<class ItemType, class Compare>
+template<class ForwardIterator>
+void MappedSearchTree<ItemType, Compare>::writeBalanced(BinaryWriter& writer, ForwardIterator& current,
+	std::size_t start, std::size_t count)
+{
+	if (count == 0)
+		return; // end if-else
+
+	std::size_t leftCount = (count - 1) / 2;
+	std::size_t rightCount = count - 1 - leftCount;
+	std::size_t middle = start + leftCount;
+
+	writeBalanced(writer, current, start, leftCount);
+
+	// Zeroing the node first keeps its padding out of the file.
+	Node node;
+	std::fill_n(reinterpret_cast<char*>(&node), sizeof(Node), '\0');
+	node.item = *current;
+	++current;
+
+	// The children are the middles of the two halves.
+	if (leftCount > 0)
+		node.leftOffset = -static_cast<std::int32_t>(middle - (start + (leftCount - 1) / 2)); // end if-else
+	if (rightCount > 0)
+		node.rightOffset = static_cast<std::int32_t>(1 + (rightCount - 1) / 2); // end if-else
+
+	writer.writeBytes(&node, sizeof(Node));
+	writeBalanced(writer, current, middle + 1, rightCount);
+} // end writeBalanced
+
+template<class ItemType, class Compare>
+template<class ForwardIterator>
+void MappedSearchTree<ItemType, Compare>::writeEntries(const std::string& fileName, ForwardIterator first,
+	std::size_t count)
+{
+	if (count > 0x7fffffff)
+		throw SerializationException("A mapped tree holds fewer than 2^31 entries."); // end if-else
+
+	Header header;
+	std::fill_n(reinterpret_cast<char*>(&header), sizeof(Header), '\0');
+	std::copy_n("BSTM", sizeof(header.magic), header.magic);
+	header.byteOrderMark = BYTE_ORDER_MARK;
+	header.version = VERSION;
+	header.itemSize = static_cast<std::uint32_t>(sizeof(ItemType));
+	header.nodeSize = static_cast<std::uint32_t>(sizeof(Node));
+	header.nodeCount = count;
+	header.rootIndex = (count > 0) ? (count - 1) / 2 : 0;
+	for (std::size_t levelStart = 1; levelStart <= count; levelStart *= 2)
+		++header.height; // end for
+
+	std::ofstream output(fileName, std::ios_base::binary | std::ios_base::trunc);
+	if (!output)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	BinaryWriter writer(output);
+	writer.writeBytes(&header, sizeof(Header));
+	writeBalanced(writer, first, 0, count);
+	writer.flush();
+} // end writeEntries
+
+// ---------------------------------------------------------------------------
+// Iterator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::Iterator::Iterator() : nodePtr(nullptr)
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::Iterator::Iterator(const Node* currentPtr) : nodePtr(currentPtr)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator::reference
+MappedSearchTree<ItemType, Compare>::Iterator::operator*() const
+{
+	return nodePtr->item;
+} // end operator*
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator::pointer
+MappedSearchTree<ItemType, Compare>::Iterator::operator->() const
+{
+	return &nodePtr->item;
+} // end operator->
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator::reference
+MappedSearchTree<ItemType, Compare>::Iterator::operator[](difference_type distance) const
+{
+	return nodePtr[distance].item;
+} // end operator[]
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator& MappedSearchTree<ItemType, Compare>::Iterator::operator++()
+{
+	++nodePtr;
+	return *this;
+} // end operator++
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator MappedSearchTree<ItemType, Compare>::Iterator::operator++(int)
+{
+	Iterator previous(*this);
+	++nodePtr;
+	return previous;
+} // end operator++
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator& MappedSearchTree<ItemType, Compare>::Iterator::operator--()
+{
+	--nodePtr;
+	return *this;
+} // end operator--
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator MappedSearchTree<ItemType, Compare>::Iterator::operator--(int)
+{
+	Iterator previous(*this);
+	--nodePtr;
+	return previous;
+} // end operator--
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator&
+MappedSearchTree<ItemType, Compare>::Iterator::operator+=(difference_type distance)
+{
+	nodePtr += distance;
+	return *this;
+} // end operator+=
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator&
+MappedSearchTree<ItemType, Compare>::Iterator::operator-=(difference_type distance)
+{
+	nodePtr -= distance;
+	return *this;
+} // end operator-=
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator
+MappedSearchTree<ItemType, Compare>::Iterator::operator+(difference_type distance) const
+{
+	return Iterator(nodePtr + distance);
+} // end operator+
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator
+MappedSearchTree<ItemType, Compare>::Iterator::operator-(difference_type distance) const
+{
+	return Iterator(nodePtr - distance);
+} // end operator-
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::Iterator::difference_type
+MappedSearchTree<ItemType, Compare>::Iterator::operator-(const Iterator& rightHandSide) const
+{
+	return nodePtr - rightHandSide.nodePtr;
+} // end operator-
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator==(const Iterator& rightHandSide) const
+{
+	return nodePtr == rightHandSide.nodePtr;
+} // end operator==
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator!=(const Iterator& rightHandSide) const
+{
+	return nodePtr != rightHandSide.nodePtr;
+} // end operator!=
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator<(const Iterator& rightHandSide) const
+{
+	return nodePtr < rightHandSide.nodePtr;
+} // end operator<
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator>(const Iterator& rightHandSide) const
+{
+	return nodePtr > rightHandSide.nodePtr;
+} // end operator>
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator<=(const Iterator& rightHandSide) const
+{
+	return nodePtr <= rightHandSide.nodePtr;
+} // end operator<=
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::Iterator::operator>=(const Iterator& rightHandSide) const
+{
+	return nodePtr >= rightHandSide.nodePtr;
+} // end operator>=
+
+// ---------------------------------------------------------------------------
+// Constructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::MappedSearchTree()
+	: nodesPtr(nullptr), nodeCount(0), rootIndex(0), height(0), comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::MappedSearchTree(const Compare& treeComparator)
+	: nodesPtr(nullptr), nodeCount(0), rootIndex(0), height(0), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::MappedSearchTree(const std::string& fileName, const Compare& treeComparator)
+	: nodesPtr(nullptr), nodeCount(0), rootIndex(0), height(0), comparator(treeComparator)
+{
+	open(fileName);
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>::MappedSearchTree(MappedSearchTree<ItemType, Compare>&& tree)
+	: file(std::move(tree.file)), nodesPtr(tree.nodesPtr), nodeCount(tree.nodeCount),
+	rootIndex(tree.rootIndex), height(tree.height), comparator(tree.comparator)
+{
+	tree.close();
+} // end move constructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class ForwardIterator>
+void MappedSearchTree<ItemType, Compare>::writeImage(const std::string& fileName, ForwardIterator first,
+	ForwardIterator last)
+{
+	writeEntries(fileName, first, static_cast<std::size_t>(std::distance(first, last)));
+} // end writeImage
+
+template<class ItemType, class Compare>
+void MappedSearchTree<ItemType, Compare>::open(const std::string& fileName)
+{
+	close();
+	MappedFile mappedFile(fileName);
+
+	Header header;
+	if (mappedFile.getSize() < sizeof(Header))
+		throw SerializationException("The file " + fileName + " holds no mapped tree."); // end if-else
+	std::copy_n(mappedFile.getData(), sizeof(Header), reinterpret_cast<char*>(&header));
+
+	if (!std::equal(header.magic, header.magic + sizeof(header.magic), "BSTM") || header.version != VERSION)
+		throw SerializationException("The file " + fileName + " holds no mapped tree."); // end if-else
+
+	if (header.byteOrderMark != BYTE_ORDER_MARK || header.itemSize != sizeof(ItemType)
+		|| header.nodeSize != sizeof(Node))
+	{
+		throw SerializationException("The tree in " + fileName
+			+ " was written with entries of a different kind or byte order.");
+	} // end if-else
+
+	// The size of the file is checked, but the nodes themselves are not
+	// read, which keeps opening O(1).
+	if (header.nodeCount > 0x7fffffff
+		|| mappedFile.getSize() - sizeof(Header) != header.nodeCount * sizeof(Node)
+		|| (header.nodeCount > 0 && header.rootIndex >= header.nodeCount))
+	{
+		throw SerializationException("The file " + fileName + " holds a damaged tree.");
+	} // end if-else
+
+	file = std::move(mappedFile);
+	nodeCount = static_cast<std::size_t>(header.nodeCount);
+	rootIndex = static_cast<std::size_t>(header.rootIndex);
+	height = static_cast<int>(header.height);
+	if (nodeCount > 0)
+		nodesPtr = reinterpret_cast<const Node*>(file.getData() + sizeof(Header)); // end if-else
+} // end open
+
+template<class ItemType, class Compare>
+void MappedSearchTree<ItemType, Compare>::close()
+{
+	file.close();
+	nodesPtr = nullptr;
+	nodeCount = 0;
+	rootIndex = 0;
+	height = 0;
+} // end close
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::isEmpty() const
+{
+	return nodeCount == 0;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int MappedSearchTree<ItemType, Compare>::getHeight() const
+{
+	return height;
+} // end getHeight
+
+template<class ItemType, class Compare>
+int MappedSearchTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return static_cast<int>(nodeCount);
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+const ItemType& MappedSearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	std::size_t index = findBoundIndex(anEntry, false);
+
+	if (index == nodeCount || lessThan(anEntry, nodesPtr[index].item))
+		throw NotFoundException("The entry does not exist within the mapped search tree.");
+	else
+		return nodesPtr[index].item; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool MappedSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	std::size_t index = findBoundIndex(anEntry, false);
+	return index != nodeCount && !lessThan(anEntry, nodesPtr[index].item);
+} // end contains
+
+template<class ItemType, class Compare>
+Compare MappedSearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Range Queries Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::iterator
+MappedSearchTree<ItemType, Compare>::lowerBound(const ItemType& anEntry) const
+{
+	return iterator(nodesPtr + findBoundIndex(anEntry, false));
+} // end lowerBound
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::iterator
+MappedSearchTree<ItemType, Compare>::upperBound(const ItemType& anEntry) const
+{
+	return iterator(nodesPtr + findBoundIndex(anEntry, true));
+} // end upperBound
+
+template<class ItemType, class Compare>
+std::pair<typename MappedSearchTree<ItemType, Compare>::iterator,
+	typename MappedSearchTree<ItemType, Compare>::iterator>
+MappedSearchTree<ItemType, Compare>::equalRange(const ItemType& anEntry) const
+{
+	return std::make_pair(lowerBound(anEntry), upperBound(anEntry));
+} // end equalRange
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool MappedSearchTree<ItemType, Compare>::forEachInRange(const ItemType& low, const ItemType& high,
+	Visitor&& visit) const
+{
+	for (std::size_t index = findBoundIndex(low, false);
+		index < nodeCount && lessThan(nodesPtr[index].item, high); ++index)
+	{
+		if (!applyVisitor(visit, nodesPtr[index].item))
+			return false; // end if-else
+	} // end for
+
+	return true;
+} // end forEachInRange
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool MappedSearchTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	for (std::size_t index = 0; index < nodeCount; ++index)
+	{
+		if (!applyVisitor(visit, nodesPtr[index].item))
+			return false; // end if-else
+	} // end for
+
+	return true;
+} // end inorderTraverse
+
+// ---------------------------------------------------------------------------
+// Public Iterators Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::iterator MappedSearchTree<ItemType, Compare>::begin() const
+{
+	return iterator(nodesPtr);
+} // end begin
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::iterator MappedSearchTree<ItemType, Compare>::end() const
+{
+	return iterator(nodesPtr + nodeCount);
+} // end end
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::reverse_iterator MappedSearchTree<ItemType, Compare>::rbegin() const
+{
+	return reverse_iterator(end());
+} // end rbegin
+
+template<class ItemType, class Compare>
+typename MappedSearchTree<ItemType, Compare>::reverse_iterator MappedSearchTree<ItemType, Compare>::rend() const
+{
+	return reverse_iterator(begin());
+} // end rend
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+MappedSearchTree<ItemType, Compare>& MappedSearchTree<ItemType, Compare>::operator=(
+	MappedSearchTree<ItemType, Compare>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		file = std::move(rightHandSide.file);
+		nodesPtr = rightHandSide.nodesPtr;
+		nodeCount = rightHandSide.nodeCount;
+		rootIndex = rightHandSide.rootIndex;
+		height = rightHandSide.height;
+		comparator = rightHandSide.comparator;
+		rightHandSide.close();
+	} // end if-else
+
+	return *this;
+} // end operator=
@@ -0,0 +1,326 @@
+/**
+This templated class provides a read-only binary search tree that is
+used straight from a memory-mapped file. The file holds the nodes of a
+perfectly balanced tree in ascending order, and each node links to its
+children by their distance from it in nodes instead of by pointers, so
+the same bytes are a valid tree wherever the file is mapped. Opening a
+tree only maps the file and checks its header, which takes the same
+time for any size. The pages are read in on first use and shared with
+every process that opens the same file.
+
+Because the nodes are stored in ascending order, a range query reads
+one run of consecutive nodes after the search for its first entry.
+
+Entries are stored as raw bytes, so ItemType must be trivially copyable
+and hold no pointers, and a file is only opened on a machine with the
+same byte order and layout of ItemType. It must be opened with the same
+ordering it was written with.
+
+@author		Solomon Colley
+@file		MappedSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "MappedFile.h"
+#include "NotFoundException.h"
+#include "Prefetch.h"
+#include "SerializationException.h"
+#include "TreeSerialization.h"
+#include "TreeVisitor.h"
+
+template<class ItemType, class Compare>
+class BinarySearchTree;
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class MappedSearchTree
+{
+	static_assert(std::is_trivially_copyable<ItemType>::value,
+		"A mapped tree stores its entries as raw bytes.");
+
+private:
+	static const std::uint32_t VERSION = 1;					// Version written to the header.
+	static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;	// Reads differently on a machine of the other byte order.
+
+	/**
+	A node of the file. The offsets count nodes from this one, so the
+	children of nodesPtr[i] are nodesPtr[i + leftOffset] and
+	nodesPtr[i + rightOffset], and an offset of 0 means no child.
+	*/
+	struct Node
+	{
+		ItemType item;				// Data portion.
+		std::int32_t leftOffset;	// Distance to the left child, which is negative.
+		std::int32_t rightOffset;	// Distance to the right child, which is positive.
+	}; // end Node
+
+	/**
+	The first 64 bytes of the file, which keep the nodes that follow
+	aligned.
+	*/
+	struct Header
+	{
+		char magic[4];					// "BSTM".
+		std::uint32_t byteOrderMark;	// BYTE_ORDER_MARK as the writer stored it.
+		std::uint32_t version;			// Version of the layout.
+		std::uint32_t itemSize;			// sizeof(ItemType) of the writer.
+		std::uint32_t nodeSize;			// sizeof(Node) of the writer.
+		std::uint32_t height;			// Height of the tree.
+		std::uint64_t nodeCount;		// Number of nodes.
+		std::uint64_t rootIndex;		// Index of the root node.
+		char reserved[24];				// Zero.
+	}; // end Header
+
+	static_assert(sizeof(Header) == 64, "The header of a mapped tree takes 64 bytes.");
+	static_assert(alignof(Node) <= sizeof(Header), "The nodes of a mapped tree must stay aligned.");
+
+	MappedFile file;			// Mapping of the open file.
+	const Node* nodesPtr;		// Nodes in ascending order, or nullptr if the tree is empty.
+	std::size_t nodeCount;		// Number of nodes.
+	std::size_t rootIndex;		// Index of the root node.
+	int height;					// Height of the tree.
+	Compare comparator;			// Strict weak ordering of the entries.
+
+	// A search tree writes its entries without counting them first.
+	friend class BinarySearchTree<ItemType, Compare>;
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree.
+	@param		const ItemType& left
+	@param		const ItemType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	bool lessThan(const ItemType& left, const ItemType& right) const;
+
+	/**
+	Returns the index of the first node that is not less than anEntry, or
+	greater than anEntry when isStrict is true. Both children of each node
+	on the way are prefetched while it is compared.
+	@param		const ItemType& anEntry
+	@param		bool isStrict
+	@return		The index of the node, or the number of nodes if every
+					entry is ordered before anEntry.
+	*/
+	std::size_t findBoundIndex(const ItemType& anEntry, bool isStrict) const;
+
+	/**
+	Writes the nodes of a perfectly balanced tree over the next count
+	entries, which take the indexes start to start + count - 1, in
+	ascending order. The recursion is only log2(count) levels deep.
+	@param		BinaryWriter& writer
+	@param		ForwardIterator& current
+	@param		std::size_t start
+	@param		std::size_t count
+	@return		void
+	*/
+	template<class ForwardIterator>
+	static void writeBalanced(BinaryWriter& writer, ForwardIterator& current, std::size_t start,
+		std::size_t count);
+
+	/**
+	Writes a file holding the count entries that start at first.
+	@pre		The entries are in ascending order.
+	@param		const std::string& fileName
+	@param		ForwardIterator first
+	@param		std::size_t count
+	@return		void
+	@throws		SerializationException if the file cannot be written or
+					count is 2^31 or more.
+	*/
+	template<class ForwardIterator>
+	static void writeEntries(const std::string& fileName, ForwardIterator first, std::size_t count);
+
+public:
+	/**
+	A random access iterator over the entries in ascending order, which
+	steps from node to node of the file.
+	*/
+	class Iterator
+	{
+	private:
+		const Node* nodePtr;	// Current node, or one past the last node at the end.
+
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef ItemType value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const ItemType* pointer;
+		typedef const ItemType& reference;
+
+		Iterator();
+		explicit Iterator(const Node* currentPtr);
+
+		reference operator*() const;
+		pointer operator->() const;
+		reference operator[](difference_type distance) const;
+
+		Iterator& operator++();
+		Iterator operator++(int);
+		Iterator& operator--();
+		Iterator operator--(int);
+		Iterator& operator+=(difference_type distance);
+		Iterator& operator-=(difference_type distance);
+		Iterator operator+(difference_type distance) const;
+		Iterator operator-(difference_type distance) const;
+		difference_type operator-(const Iterator& rightHandSide) const;
+
+		bool operator==(const Iterator& rightHandSide) const;
+		bool operator!=(const Iterator& rightHandSide) const;
+		bool operator<(const Iterator& rightHandSide) const;
+		bool operator>(const Iterator& rightHandSide) const;
+		bool operator<=(const Iterator& rightHandSide) const;
+		bool operator>=(const Iterator& rightHandSide) const;
+	}; // end Iterator
+
+	typedef Iterator iterator;
+	typedef Iterator const_iterator;
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	// ---------------------------------------------------------------------------
+	// Constructor Section.
+	// A tree owns the mapping of its file, so it is moved but never copied.
+	// ---------------------------------------------------------------------------
+
+	MappedSearchTree();
+	explicit MappedSearchTree(const Compare& treeComparator);
+
+	/**
+	Opens the named file, as open does.
+	@param		const std::string& fileName
+	@param		const Compare& treeComparator
+	@throws		SerializationException if the file cannot be opened.
+	*/
+	explicit MappedSearchTree(const std::string& fileName, const Compare& treeComparator = Compare());
+
+	MappedSearchTree(MappedSearchTree<ItemType, Compare>&& tree);
+	MappedSearchTree(const MappedSearchTree<ItemType, Compare>& tree) = delete;
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Writes the entries in the range [first, last) to a file that is
+	replaced, as a perfectly balanced tree, through a buffer of fixed
+	size.
+	@pre		The range is sorted in ascending order. Duplicates are
+					allowed.
+	@param		const std::string& fileName
+	@param		ForwardIterator first
+	@param		ForwardIterator last
+	@return		void
+	@throws		SerializationException if the file cannot be written or
+					the range holds 2^31 entries or more.
+	*/
+	template<class ForwardIterator>
+	static void writeImage(const std::string& fileName, ForwardIterator first, ForwardIterator last);
+
+	/**
+	Maps the named file and uses it as this tree in O(1) time. Only the
+	header is read, so the nodes are trusted to be as writeImage wrote
+	them.
+	@post		The tree holds the entries of the file, or is empty if
+					opening failed.
+	@param		const std::string& fileName
+	@return		void
+	@throws		SerializationException if the file cannot be mapped or its
+					header does not describe a tree of this entry type
+					written on a machine of the same byte order.
+	*/
+	void open(const std::string& fileName);
+
+	/**
+	Releases the mapped file. Iterators and references to entries become
+	invalid.
+	@post		The tree is empty.
+	@return		void
+	*/
+	void close();
+
+	bool isEmpty() const;
+	int getHeight() const;
+	int getNumberOfNodes() const;
+
+	/**
+	Returns the first entry equivalent to anEntry, or whether one occurs
+	in the tree, as the methods of BinarySearchTree do. The reference
+	points into the mapped file.
+	@param		const ItemType& anEntry
+	@return		A reference to the entry, or whether it was found.
+	@throws		NotFoundException if getEntry finds no such entry.
+	*/
+	const ItemType& getEntry(const ItemType& anEntry) const;
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Range Queries Section.
+	// These behave as the range queries of BinarySearchTree do, in
+	// O(log n + k) time for k results.
+	// ---------------------------------------------------------------------------
+
+	iterator lowerBound(const ItemType& anEntry) const;
+	iterator upperBound(const ItemType& anEntry) const;
+	std::pair<iterator, iterator> equalRange(const ItemType& anEntry) const;
+
+	/**
+	Calls visit in ascending order with a constant reference to each entry
+	that is not less than low and less than high. If visit returns a
+	value, the visitation stops as soon as that value is false.
+	@param		const ItemType& low
+	@param		const ItemType& high
+	@param		Visitor&& visit
+	@return		True if every entry in the range was visited, or false if
+					visit stopped the visitation.
+	*/
+	template<class Visitor>
+	bool forEachInRange(const ItemType& low, const ItemType& high, Visitor&& visit) const;
+
+	/**
+	Calls visit with every entry in ascending order, which reads the file
+	from start to end.
+	@param		Visitor&& visit
+	@return		True if every entry was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Iterators Section.
+	// The iterators visit the entries in ascending order.
+	// ---------------------------------------------------------------------------
+
+	iterator begin() const;
+	iterator end() const;
+	reverse_iterator rbegin() const;
+	reverse_iterator rend() const;
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// ---------------------------------------------------------------------------
+
+	MappedSearchTree& operator=(MappedSearchTree<ItemType, Compare>&& rightHandSide);
+	MappedSearchTree& operator=(const MappedSearchTree<ItemType, Compare>& rightHandSide) = delete;
+}; // end MappedSearchTree
+
+#include "MappedSearchTree.cpp"
@@ -0,0 +1,410 @@
+/**
+This templated class provides a multiset: a balanced search tree that
+keeps each distinct entry in a single node together with the number of
+times it occurs.
+
+@author		Solomon Colley
+@file		MultisetSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "MultisetSearchTree.h"
+
+#include <fstream>
+
+// ---------------------------------------------------------------------------
+// CountedEntry Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType>
+CountedEntry<ItemType>::CountedEntry() : item(), count(0)
+{
+} // end default constructor
+
+template<class ItemType>
+CountedEntry<ItemType>::CountedEntry(const ItemType& anItem, int occurrences)
+	: item(anItem), count(occurrences)
+{
+} // end parameterized constructor
+
+template<class ItemType>
+CountedEntry<ItemType>::CountedEntry(ItemType&& anItem, int occurrences)
+	: item(std::move(anItem)), count(occurrences)
+{
+} // end parameterized constructor
+
+template<class ItemType>
+bool operator==(const CountedEntry<ItemType>& left, const CountedEntry<ItemType>& right)
+{
+	return left.item == right.item;
+} // end operator==
+
+// ---------------------------------------------------------------------------
+// CountedEntryCompare Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+CountedEntryCompare<ItemType, Compare>::CountedEntryCompare() : comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+CountedEntryCompare<ItemType, Compare>::CountedEntryCompare(const Compare& itemComparator)
+	: comparator(itemComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+bool CountedEntryCompare<ItemType, Compare>::operator()(const CountedEntry<ItemType>& left,
+	const CountedEntry<ItemType>& right) const
+{
+	return comparator(left.item, right.item);
+} // end operator()
+
+template<class ItemType, class Compare>
+bool CountedEntryCompare<ItemType, Compare>::operator()(const CountedEntry<ItemType>& left,
+	const ItemType& right) const
+{
+	return comparator(left.item, right);
+} // end operator()
+
+template<class ItemType, class Compare>
+bool CountedEntryCompare<ItemType, Compare>::operator()(const ItemType& left,
+	const CountedEntry<ItemType>& right) const
+{
+	return comparator(left, right.item);
+} // end operator()
+
+// ---------------------------------------------------------------------------
+// ItemCodec Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType>
+void ItemCodec<CountedEntry<ItemType>>::write(BinaryWriter& writer, const CountedEntry<ItemType>& anEntry)
+{
+	ItemCodec<ItemType>::write(writer, anEntry.item);
+	writer.writeVarint(static_cast<unsigned long long>(anEntry.count));
+} // end write
+
+template<class ItemType>
+CountedEntry<ItemType> ItemCodec<CountedEntry<ItemType>>::read(BinaryReader& reader)
+{
+	ItemType anItem = ItemCodec<ItemType>::read(reader);
+	unsigned long long occurrences = reader.readVarint();
+	if (occurrences == 0 || occurrences > static_cast<unsigned long long>(INT_MAX))
+		throw SerializationException("The stream holds an entry with an invalid count."); // end if-else
+
+	return CountedEntry<ItemType>(std::move(anItem), static_cast<int>(occurrences));
+} // end read
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class NewItem>
+bool MultisetSearchTree<ItemType, Compare>::addOccurrences(NewItem&& newEntry, int occurrences)
+{
+	if (occurrences < 1)
+		throw PreconditionException("Function add() was called with fewer than one occurrence."); // end if-else
+
+	BinaryNode<Entry>* nodePtr = this->findEntryNode(newEntry);
+	if (nodePtr != nullptr)
+	{
+		const Entry& counted = nodePtr->getItem();
+		if (counted.count > INT_MAX - occurrences)
+			throw PreconditionException("Function add() would count an entry more than INT_MAX times."); // end if-else
+
+		counted.count += occurrences;
+		this->getCounters().countInsertion();
+	}
+	else
+		Base::add(Entry(std::forward<NewItem>(newEntry), occurrences)); // end if-else
+
+	entryCount += occurrences;
+	return true;
+} // end addOccurrences
+
+template<class ItemType, class Compare>
+void MultisetSearchTree<ItemType, Compare>::recountEntries()
+{
+	long long total = 0;
+	Base::inorderTraverse([&total](const Entry& anEntry) { total += anEntry.count; });
+	entryCount = total;
+} // end recountEntries
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>::MultisetSearchTree() : Base(), entryCount(0)
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>::MultisetSearchTree(const Compare& treeComparator)
+	: Base(EntryCompare(treeComparator)), entryCount(0)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+MultisetSearchTree<ItemType, Compare>::MultisetSearchTree(InputIterator first, InputIterator last,
+	const Compare& treeComparator) : Base(EntryCompare(treeComparator)), entryCount(0)
+{
+	assign(first, last);
+} // end range constructor
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>::MultisetSearchTree(const MultisetSearchTree<ItemType, Compare>& tree)
+	: Base(tree), entryCount(tree.entryCount)
+{
+} // end copy constructor
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>::MultisetSearchTree(MultisetSearchTree<ItemType, Compare>&& tree)
+	: Base(std::move(tree)), entryCount(tree.entryCount)
+{
+	tree.entryCount = 0;
+} // end move constructor
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>::~MultisetSearchTree()
+{
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::isEmpty() const
+{
+	return Base::isEmpty();
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int MultisetSearchTree<ItemType, Compare>::getHeight() const
+{
+	return Base::getHeight();
+} // end getHeight
+
+template<class ItemType, class Compare>
+int MultisetSearchTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return Base::getNumberOfNodes();
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+long long MultisetSearchTree<ItemType, Compare>::getNumberOfEntries() const
+{
+	return entryCount;
+} // end getNumberOfEntries
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	return addOccurrences(newEntry, 1);
+} // end add
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::add(ItemType&& newEntry)
+{
+	return addOccurrences(std::move(newEntry), 1);
+} // end add
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::add(const ItemType& newEntry, int occurrences)
+{
+	return addOccurrences(newEntry, occurrences);
+} // end add
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::remove(const ItemType& anEntry)
+{
+	BinaryNode<Entry>* nodePtr = this->findEntryNode(anEntry);
+	if (nodePtr == nullptr)
+	{
+		this->getCounters().countRemoval();
+		return false;
+	} // end if-else
+
+	const Entry& counted = nodePtr->getItem();
+	if (counted.count > 1)
+	{
+		--counted.count;
+		this->getCounters().countRemoval();
+	}
+	else
+	{
+		// The target is copied because its node is freed during the removal.
+		Entry target(counted);
+		Base::remove(target);
+	} // end if-else
+
+	--entryCount;
+	return true;
+} // end remove
+
+template<class ItemType, class Compare>
+int MultisetSearchTree<ItemType, Compare>::removeAll(const ItemType& anEntry)
+{
+	BinaryNode<Entry>* nodePtr = this->findEntryNode(anEntry);
+	if (nodePtr == nullptr)
+		return 0; // end if-else
+
+	Entry target(nodePtr->getItem());
+	Base::remove(target);
+	entryCount -= target.count;
+	return target.count;
+} // end removeAll
+
+template<class ItemType, class Compare>
+void MultisetSearchTree<ItemType, Compare>::clear()
+{
+	Base::clear();
+	entryCount = 0;
+} // end clear
+
+template<class ItemType, class Compare>
+int MultisetSearchTree<ItemType, Compare>::count(const ItemType& anEntry) const
+{
+	BinaryNode<Entry>* nodePtr = this->findEntryNode(anEntry);
+	return (nodePtr != nullptr) ? nodePtr->getItem().count : 0;
+} // end count
+
+template<class ItemType, class Compare>
+const ItemType& MultisetSearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	BinaryNode<Entry>* nodePtr = this->findEntryNode(anEntry);
+	if (nodePtr == nullptr)
+		throw NotFoundException("The target value was not found in the tree."); // end if-else
+
+	return nodePtr->getItem().item;
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool MultisetSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	return this->findEntryNode(anEntry) != nullptr;
+} // end contains
+
+template<class ItemType, class Compare>
+Compare MultisetSearchTree<ItemType, Compare>::getComparator() const
+{
+	return Base::getComparator().comparator;
+} // end getComparator
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+void MultisetSearchTree<ItemType, Compare>::assign(InputIterator first, InputIterator last)
+{
+	std::vector<ItemType> items(first, last);
+	Compare comparator = getComparator();
+	std::sort(items.begin(), items.end(), comparator);
+
+	// Each run of equivalent items becomes one counted entry.
+	std::vector<Entry> entries;
+	std::size_t runStart = 0;
+	while (runStart < items.size())
+	{
+		std::size_t runEnd = runStart + 1;
+		while (runEnd < items.size() && !comparator(items[runStart], items[runEnd]))
+			++runEnd; // end while
+
+		entries.emplace_back(std::move(items[runStart]), static_cast<int>(runEnd - runStart));
+		runStart = runEnd;
+	} // end while
+
+	Base::assignSorted(std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+	entryCount = static_cast<long long>(items.size());
+} // end assign
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool MultisetSearchTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	return Base::inorderTraverse([&visit](const Entry& anEntry)
+	{
+		for (int occurrence = 0; occurrence < anEntry.count; ++occurrence)
+		{
+			if (!applyVisitor(visit, anEntry.item))
+				return false; // end if-else
+		} // end for
+
+		return true;
+	});
+} // end inorderTraverse
+
+// ---------------------------------------------------------------------------
+// Public Persistence Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+void MultisetSearchTree<ItemType, Compare>::load(std::istream& input)
+{
+	entryCount = 0;
+	Base::load(input);
+
+	// Loading only checks that the entries do not descend, so an entry
+	// saved twice is caught here.
+	const Entry* previousPtr = nullptr;
+	bool isOrdered = Base::inorderTraverse([this, &previousPtr](const Entry& anEntry)
+	{
+		if (previousPtr != nullptr && !this->lessThan(*previousPtr, anEntry))
+			return false; // end if-else
+
+		previousPtr = &anEntry;
+		return true;
+	});
+
+	if (!isOrdered)
+	{
+		Base::clear();
+		throw SerializationException("The stream holds an entry more than once.");
+	} // end if-else
+
+	recountEntries();
+} // end load
+
+template<class ItemType, class Compare>
+void MultisetSearchTree<ItemType, Compare>::load(const std::string& fileName)
+{
+	std::ifstream file(fileName, std::ios_base::binary);
+	if (!file)
+		throw SerializationException("The file " + fileName + " could not be opened."); // end if-else
+
+	load(file);
+} // end load
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>& MultisetSearchTree<ItemType, Compare>::
+operator=(const MultisetSearchTree<ItemType, Compare>& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		Base::operator=(rightHandSide);
+		entryCount = rightHandSide.entryCount;
+	} // end if-else
+
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+MultisetSearchTree<ItemType, Compare>& MultisetSearchTree<ItemType, Compare>::
+operator=(MultisetSearchTree<ItemType, Compare>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		Base::operator=(std::move(rightHandSide));
+		entryCount = rightHandSide.entryCount;
+		rightHandSide.entryCount = 0;
+	} // end if-else
+
+	return *this;
+} // end operator=
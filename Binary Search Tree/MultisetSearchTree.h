@@ -0,0 +1,319 @@
+/**
+This templated class provides a multiset: a balanced search tree that
+keeps each distinct entry in a single node together with the number of
+times it occurs. Adding an entry that is already present increments its
+count instead of linking another node, and removing one decrements the
+count and unlinks the node only when the count reaches zero. A workload
+that adds every key d times therefore needs 1/d of the nodes of a tree
+that stores the duplicates separately, and its height is that of a tree
+of the distinct keys.
+
+The nodes are those of an AVLTree whose entries are CountedEntry
+objects, which are ordered by their item alone. The count does not take
+part in the ordering, so it is changed in place without moving a node.
+
+@author		Solomon Colley
+@file		MultisetSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AVLTree.h"
+#include "BinaryNode.h"
+#include "NodePool.h"
+#include "NotFoundException.h"
+#include "PreconditionException.h"
+#include "SerializationException.h"
+#include "TreeSerialization.h"
+#include "TreeStatistics.h"
+#include "TreeVisitor.h"
+
+/**
+An entry of a MultisetSearchTree and the number of times it occurs.
+*/
+template<class ItemType>
+struct CountedEntry
+{
+	ItemType item;		// Entry the tree is ordered by.
+	mutable int count;	// Number of occurrences of item, which is at least 1 in a tree.
+
+	CountedEntry();
+	CountedEntry(const ItemType& anItem, int occurrences);
+	CountedEntry(ItemType&& anItem, int occurrences);
+}; // end CountedEntry
+
+/**
+Compares the items of two counted entries, as the shape methods of
+BinaryNodeTree require of every entry type. The counts are ignored.
+@param		const CountedEntry<ItemType>& left
+@param		const CountedEntry<ItemType>& right
+@return		True if the items are equal, or false if not.
+*/
+template<class ItemType>
+bool operator==(const CountedEntry<ItemType>& left, const CountedEntry<ItemType>& right);
+
+/**
+Orders counted entries by their items with the comparator of the tree.
+It is transparent, so that a node is found by an item alone without
+building a CountedEntry around it.
+*/
+template<class ItemType, class Compare>
+struct CountedEntryCompare
+{
+	typedef void is_transparent;
+
+	Compare comparator;		// Strict weak ordering of the items.
+
+	CountedEntryCompare();
+	explicit CountedEntryCompare(const Compare& itemComparator);
+
+	bool operator()(const CountedEntry<ItemType>& left, const CountedEntry<ItemType>& right) const;
+	bool operator()(const CountedEntry<ItemType>& left, const ItemType& right) const;
+	bool operator()(const ItemType& left, const CountedEntry<ItemType>& right) const;
+}; // end CountedEntryCompare
+
+/**
+Saves a counted entry as its item, written by the ItemCodec of the item,
+followed by its count as a variable-length integer. The tag is that of
+the item with the highest bit set, so a multiset is never loaded into a
+tree of plain entries or the other way around.
+*/
+template<class ItemType>
+struct ItemCodec<CountedEntry<ItemType>>
+{
+	static const unsigned int TAG = ItemCodec<ItemType>::TAG | 0x80000000u;
+
+	static void write(BinaryWriter& writer, const CountedEntry<ItemType>& anEntry);
+
+	/**
+	@throws		SerializationException if the stream fails or ends, or
+					the count is not between 1 and INT_MAX.
+	*/
+	static CountedEntry<ItemType> read(BinaryReader& reader);
+}; // end ItemCodec
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class MultisetSearchTree : private AVLTree<CountedEntry<ItemType>, CountedEntryCompare<ItemType, Compare>>
+{
+private:
+	typedef CountedEntry<ItemType> Entry;
+	typedef CountedEntryCompare<ItemType, Compare> EntryCompare;
+	typedef AVLTree<Entry, EntryCompare> Base;
+
+	long long entryCount;	// Sum of the counts of all nodes.
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Adds occurrences of newEntry, incrementing the count of its node if
+	it has one and inserting a node otherwise.
+	@pre		occurrences >= 1.
+	@param		NewItem&& newEntry
+	@param		int occurrences
+	@return		True.
+	@throws		PreconditionException if occurrences is less than 1 or the
+					count would exceed INT_MAX.
+	*/
+	template<class NewItem>
+	bool addOccurrences(NewItem&& newEntry, int occurrences);
+
+	/**
+	Adds up the counts of all nodes after the nodes were replaced.
+	@return		void
+	*/
+	void recountEntries();
+
+public:
+	/**
+	The iterators visit each distinct entry once, in ascending order, as a
+	CountedEntry whose item and count are read through the iterator.
+	*/
+	typedef typename Base::iterator iterator;
+	typedef typename Base::const_iterator const_iterator;
+	typedef typename Base::reverse_iterator reverse_iterator;
+	typedef typename Base::const_reverse_iterator const_reverse_iterator;
+
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	MultisetSearchTree();
+	explicit MultisetSearchTree(const Compare& treeComparator);
+
+	/**
+	Constructs a multiset holding the entries in the range [first, last),
+	which need not be sorted. See assign.
+	@param		InputIterator first
+	@param		InputIterator last
+	@param		const Compare& treeComparator
+	*/
+	template<class InputIterator>
+	MultisetSearchTree(InputIterator first, InputIterator last, const Compare& treeComparator = Compare());
+	MultisetSearchTree(const MultisetSearchTree<ItemType, Compare>& tree);
+	MultisetSearchTree(MultisetSearchTree<ItemType, Compare>&& tree);
+	virtual ~MultisetSearchTree();
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+	int getHeight() const;
+
+	/**
+	Returns the number of nodes, which is the number of distinct entries.
+	@return		The number of distinct entries in this multiset.
+	*/
+	int getNumberOfNodes() const;
+
+	/**
+	Returns the number of entries counting every occurrence, in O(1) time.
+	@return		The sum of the counts of all distinct entries.
+	*/
+	long long getNumberOfEntries() const;
+
+	/**
+	Adds one occurrence of newEntry, or the given number of occurrences.
+	Only the first occurrence of an entry allocates a node; later ones
+	increment the count of that node after a single search.
+	@post		count(newEntry) has grown by occurrences.
+	@param		const ItemType& newEntry
+	@param		int occurrences
+	@return		True if the addition was successful.
+	@throws		PreconditionException if occurrences is less than 1 or the
+					count of the entry would exceed INT_MAX.
+	*/
+	bool add(const ItemType& newEntry);
+	bool add(ItemType&& newEntry);
+	bool add(const ItemType& newEntry, int occurrences);
+
+	/**
+	Removes one occurrence of anEntry. The node of the entry is unlinked
+	and freed when its count reaches zero.
+	@post		count(anEntry) has shrunk by one if it was positive.
+	@param		const ItemType& anEntry
+	@return		True if an occurrence was removed, or false if anEntry
+					does not occur in the multiset.
+	*/
+	bool remove(const ItemType& anEntry);
+
+	/**
+	Removes every occurrence of anEntry along with its node.
+	@post		count(anEntry) is 0.
+	@param		const ItemType& anEntry
+	@return		The number of occurrences that were removed.
+	*/
+	int removeAll(const ItemType& anEntry);
+
+	void clear();
+
+	/**
+	Returns the number of occurrences of anEntry after one search from the
+	root, in O(log n) time for n distinct entries.
+	@param		const ItemType& anEntry
+	@return		The count of anEntry, or 0 if it does not occur.
+	*/
+	int count(const ItemType& anEntry) const;
+
+	/**
+	Returns the stored entry equivalent to anEntry, or whether it occurs
+	in the multiset.
+	@param		const ItemType& anEntry
+	@return		A reference to the entry, or whether it was found.
+	@throws		NotFoundException if getEntry finds no such entry.
+	*/
+	const ItemType& getEntry(const ItemType& anEntry) const;
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries.
+	@return		The comparator of this multiset.
+	*/
+	Compare getComparator() const;
+
+	/**
+	Replaces the entries of this multiset with the entries in the range
+	[first, last) in any order. The entries are sorted, each run of
+	equivalent entries becomes one counted entry, and the counted entries
+	are built into a perfectly balanced tree, in O(n log n) time overall.
+	@post		The multiset holds exactly the entries of the range.
+	@param		InputIterator first
+	@param		InputIterator last
+	@return		void
+	*/
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last);
+
+	/**
+	Calls visit in ascending order with a constant reference to every
+	occurrence of every entry, so an entry with a count of 3 is visited
+	three times in a row. If visit returns a value, the traversal stops
+	as soon as that value is false.
+	@param		Visitor&& visit
+	@return		True if every occurrence was visited, or false if visit
+					stopped the traversal.
+	*/
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Public Iterators Section.
+	// ---------------------------------------------------------------------------
+
+	using Base::begin;
+	using Base::end;
+	using Base::rbegin;
+	using Base::rend;
+
+	// ---------------------------------------------------------------------------
+	// Public Persistence Section.
+	// A multiset is saved in the sorted layout of @file TreeSerialization.h
+	// with one counted entry per node, so a duplicate-heavy multiset takes
+	// as little room on disk as in memory.
+	// ---------------------------------------------------------------------------
+
+	using Base::save;
+
+	/**
+	Replaces the entries of this multiset with a multiset saved by save.
+	@post		This multiset holds the saved entries, or is empty if
+					loading failed.
+	@param		std::istream& input
+	@return		void
+	@throws		SerializationException if the stream does not hold a
+					multiset of the same kind of entries with each entry
+					saved once in ascending order, or the file cannot be
+					opened.
+	*/
+	void load(std::istream& input);
+	void load(const std::string& fileName);
+
+	// ---------------------------------------------------------------------------
+	// Public Diagnostics Section.
+	// See @file BinaryNodeTree.h for documentation. An increment of a count
+	// is recorded as an insertion and a decrement as a removal.
+	// ---------------------------------------------------------------------------
+
+	using Base::getAllocatorStatistics;
+	using Base::getStatistics;
+	using Base::resetStatistics;
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// ---------------------------------------------------------------------------
+
+	MultisetSearchTree<ItemType, Compare>& operator=(const MultisetSearchTree<ItemType, Compare>& rightHandSide);
+	MultisetSearchTree<ItemType, Compare>& operator=(MultisetSearchTree<ItemType, Compare>&& rightHandSide);
+}; // end MultisetSearchTree
+
+#include "MultisetSearchTree.cpp"
@@ -0,0 +1,264 @@
+/**
+This templated class provides a slab allocator for binary nodes. Nodes
+are carved out of large slabs of contiguous memory instead of being
+allocated one at a time, removed nodes are recycled through a free list,
+and every slab can be released at once when the whole tree is cleared.
+The slabs are grouped into arenas that pools can share.
+
+@author		Solomon Colley
+@file		NodePool.cpp
+@since		10/18/2026
+*/
+
+#include "NodePool.h"
+
+// -------------------------------------------------------------------------------------
+// Private Utility Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+void NodePool<ItemType>::addSlab(int minimumSlots)
+{
+	int slabCapacity = (nextSlabCapacity > minimumSlots) ? nextSlabCapacity : minimumSlots;
+
+	// Pools that share arenas may be used on different threads, so each one
+	// only adds slabs to an arena that it alone holds.
+	if (arenas.empty() || isNewestArenaShared)
+	{
+		arenas.push_back(std::make_shared<Arena>());
+		arenas.back()->capacity = 0;
+		isNewestArenaShared = false;
+	} // end if-else
+
+	Arena& arena = *arenas.back();
+	arena.slabs.push_back(std::unique_ptr<Slot[]>(new Slot[slabCapacity]));
+	arena.capacity += slabCapacity;
+	nextUnusedPtr = arena.slabs.back().get();
+	unusedInSlab = slabCapacity;
+
+	if (nextSlabCapacity < MAX_SLAB_CAPACITY)
+		nextSlabCapacity *= 2; // end if-else
+} // end addSlab
+
+template<class ItemType>
+typename NodePool<ItemType>::Slot* NodePool<ItemType>::takeSlot()
+{
+	Slot* slotPtr;
+
+	if (freeListPtr != nullptr)
+	{
+		slotPtr = freeListPtr;
+		freeListPtr = slotPtr->nextFreePtr;
+		--freeListLength;
+	}
+	else
+	{
+		if (unusedInSlab == 0)
+			addSlab(1); // end if-else
+		slotPtr = nextUnusedPtr++;
+		--unusedInSlab;
+	} // end if-else
+
+	++liveNodes;
+	return slotPtr;
+} // end takeSlot
+
+template<class ItemType>
+void NodePool<ItemType>::freeUnusedSlots()
+{
+	while (unusedInSlab > 0)
+	{
+		Slot* slotPtr = nextUnusedPtr++;
+		slotPtr->nextFreePtr = freeListPtr;
+		freeListPtr = slotPtr;
+		++freeListLength;
+		--unusedInSlab;
+	} // end while
+} // end freeUnusedSlots
+
+// -------------------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+NodePool<ItemType>::NodePool() : isNewestArenaShared(false), freeListPtr(nullptr), nextUnusedPtr(nullptr),
+	unusedInSlab(0), nextSlabCapacity(MIN_SLAB_CAPACITY), liveNodes(0), freeListLength(0)
+{
+} // end default constructor
+
+template<class ItemType>
+NodePool<ItemType>::NodePool(NodePool<ItemType>&& pool) : arenas(std::move(pool.arenas)),
+	isNewestArenaShared(pool.isNewestArenaShared), freeListPtr(pool.freeListPtr),
+	nextUnusedPtr(pool.nextUnusedPtr), unusedInSlab(pool.unusedInSlab),
+	nextSlabCapacity(pool.nextSlabCapacity), liveNodes(pool.liveNodes), freeListLength(pool.freeListLength)
+{
+	pool.arenas.clear();
+	pool.releaseAll();
+} // end move constructor
+
+template<class ItemType>
+NodePool<ItemType>::~NodePool()
+{
+} // end destructor
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+template<class... Args>
+BinaryNode<ItemType>* NodePool<ItemType>::allocate(Args&&... args)
+{
+	Slot* slotPtr = takeSlot();
+
+	try
+	{
+		return new (&slotPtr->storage) BinaryNode<ItemType>(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// The item's constructor threw, so the slot goes back unused.
+		slotPtr->nextFreePtr = freeListPtr;
+		freeListPtr = slotPtr;
+		++freeListLength;
+		--liveNodes;
+		throw;
+	} // end try-catch
+} // end allocate
+
+template<class ItemType>
+void NodePool<ItemType>::deallocate(BinaryNode<ItemType>* nodePtr)
+{
+	nodePtr->~BinaryNode<ItemType>();
+
+	Slot* slotPtr = reinterpret_cast<Slot*>(nodePtr);
+	slotPtr->nextFreePtr = freeListPtr;
+	freeListPtr = slotPtr;
+	++freeListLength;
+	--liveNodes;
+} // end deallocate
+
+template<class ItemType>
+void NodePool<ItemType>::reserve(int count)
+{
+	if (count > unusedInSlab + freeListLength)
+	{
+		freeUnusedSlots();
+		addSlab(count - freeListLength);
+	} // end if-else
+} // end reserve
+
+template<class ItemType>
+BinaryNode<ItemType>* NodePool<ItemType>::allocateBlock(int count)
+{
+	if (count > unusedInSlab)
+	{
+		freeUnusedSlots();
+		addSlab(count);
+	} // end if-else
+
+	Slot* blockPtr = nextUnusedPtr;
+	nextUnusedPtr += count;
+	unusedInSlab -= count;
+	liveNodes += count;
+	return reinterpret_cast<BinaryNode<ItemType>*>(blockPtr);
+} // end allocateBlock
+
+template<class ItemType>
+void NodePool<ItemType>::deallocateBlock(BinaryNode<ItemType>* blockPtr, int count)
+{
+	Slot* slotPtr = reinterpret_cast<Slot*>(blockPtr);
+	for (int i = count - 1; i >= 0; --i)
+	{
+		slotPtr[i].nextFreePtr = freeListPtr;
+		freeListPtr = &slotPtr[i];
+	} // end for
+
+	freeListLength += count;
+	liveNodes -= count;
+} // end deallocateBlock
+
+template<class ItemType>
+void NodePool<ItemType>::shareWith(NodePool<ItemType>& targetPool, int nodeCount)
+{
+	if (this == &targetPool || nodeCount == 0)
+		return; // end if-else
+
+	// The arena that targetPool adds slabs to is kept last, and this pool
+	// starts a new one for its next slab.
+	std::vector<std::shared_ptr<Arena>>& targetArenas = targetPool.arenas;
+	std::shared_ptr<Arena> privateArenaPtr;
+	if (!targetPool.isNewestArenaShared && !targetArenas.empty())
+	{
+		privateArenaPtr = std::move(targetArenas.back());
+		targetArenas.pop_back();
+	} // end if-else
+
+	targetArenas.insert(targetArenas.end(), arenas.begin(), arenas.end());
+	std::sort(targetArenas.begin(), targetArenas.end());
+	targetArenas.erase(std::unique(targetArenas.begin(), targetArenas.end()), targetArenas.end());
+
+	targetPool.isNewestArenaShared = (privateArenaPtr == nullptr);
+	if (privateArenaPtr != nullptr)
+		targetArenas.push_back(std::move(privateArenaPtr)); // end if-else
+	isNewestArenaShared = true;
+
+	liveNodes -= nodeCount;
+	targetPool.liveNodes += nodeCount;
+} // end shareWith
+
+template<class ItemType>
+void NodePool<ItemType>::releaseAll()
+{
+	arenas.clear();
+	isNewestArenaShared = false;
+	freeListPtr = nullptr;
+	nextUnusedPtr = nullptr;
+	unusedInSlab = 0;
+	nextSlabCapacity = MIN_SLAB_CAPACITY;
+	liveNodes = 0;
+	freeListLength = 0;
+} // end releaseAll
+
+template<class ItemType>
+NodePoolStatistics NodePool<ItemType>::getStatistics() const
+{
+	NodePoolStatistics statistics;
+	statistics.slabs = 0;
+	statistics.capacity = 0;
+	for (const std::shared_ptr<Arena>& arenaPtr : arenas)
+	{
+		statistics.slabs += static_cast<int>(arenaPtr->slabs.size());
+		statistics.capacity += arenaPtr->capacity;
+	} // end for
+
+	statistics.liveNodes = liveNodes;
+	statistics.freeListLength = freeListLength;
+	statistics.bytesReserved = static_cast<long long>(statistics.capacity) * sizeof(Slot);
+	return statistics;
+} // end getStatistics
+
+// -------------------------------------------------------------------------------------
+// Overloaded Operator Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+NodePool<ItemType>& NodePool<ItemType>::operator=(NodePool<ItemType>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		arenas = std::move(rightHandSide.arenas);
+		isNewestArenaShared = rightHandSide.isNewestArenaShared;
+		freeListPtr = rightHandSide.freeListPtr;
+		nextUnusedPtr = rightHandSide.nextUnusedPtr;
+		unusedInSlab = rightHandSide.unusedInSlab;
+		nextSlabCapacity = rightHandSide.nextSlabCapacity;
+		liveNodes = rightHandSide.liveNodes;
+		freeListLength = rightHandSide.freeListLength;
+
+		rightHandSide.arenas.clear();
+		rightHandSide.releaseAll();
+	} // end if-else
+
+	return *this;
+} // end operator=
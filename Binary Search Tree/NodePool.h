@@ -0,0 +1,206 @@
+/**
+This templated class provides a slab allocator for binary nodes. Nodes
+are carved out of large slabs of contiguous memory instead of being
+allocated one at a time, removed nodes are recycled through a free list,
+and every slab can be released at once when the whole tree is cleared.
+
+The slabs are grouped into arenas that pools can share, so that a tree can
+take over nodes of another tree without copying them. Each pool only adds
+slabs to an arena that no other pool holds, and a slot is only ever on the
+free list of the one pool whose tree owns it, so trees that share an arena
+may still be used on different threads.
+
+@author		Solomon Colley
+@file		NodePool.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "BinaryNode.h"
+
+/**
+A snapshot of the bookkeeping of a node pool, used for sizing it.
+*/
+struct NodePoolStatistics
+{
+	int slabs;				// Number of slabs currently held, including shared ones.
+	int capacity;			// Number of node slots in all slabs.
+	int liveNodes;			// Number of nodes currently allocated.
+	int freeListLength;		// Number of released slots waiting for reuse.
+	long long bytesReserved;	// Number of bytes held in slabs.
+}; // end NodePoolStatistics
+
+template<class ItemType>
+class NodePool
+{
+public:
+	static const int MIN_SLAB_CAPACITY = 32;	// Node slots in the first slab.
+	static const int MAX_SLAB_CAPACITY = 8192;	// Upper bound on the node slots in a slab.
+
+private:
+	/**
+	Storage for one node. While a slot is on the free list its memory
+	holds the pointer to the next free slot instead of a node.
+	*/
+	union Slot
+	{
+		Slot* nextFreePtr;
+		typename std::aligned_storage<sizeof(BinaryNode<ItemType>),
+			alignof(BinaryNode<ItemType>)>::type storage;
+	}; // end Slot
+
+	static_assert(sizeof(Slot) == sizeof(BinaryNode<ItemType>),
+		"A block of slots must be addressable as an array of nodes.");
+
+	/**
+	A group of slabs that is freed once no pool holds it any more.
+	*/
+	struct Arena
+	{
+		std::vector<std::unique_ptr<Slot[]>> slabs;	// The slabs of the arena.
+		int capacity;								// Node slots in all slabs.
+	}; // end Arena
+
+	std::vector<std::shared_ptr<Arena>> arenas;	// Arenas this pool may have nodes in.
+	bool isNewestArenaShared;					// Whether new slabs need a new arena.
+	Slot* freeListPtr;							// Head of the free list.
+	Slot* nextUnusedPtr;						// Next never-used slot in the newest slab.
+	int unusedInSlab;							// Never-used slots left in the newest slab.
+	int nextSlabCapacity;						// Node slots in the next slab to allocate.
+	int liveNodes;								// Nodes currently allocated.
+	int freeListLength;							// Slots currently on the free list.
+
+	/**
+	Allocates a new slab whose capacity doubles each time up to
+	MAX_SLAB_CAPACITY, or is large enough for minimumSlots.
+	@post		The newest slab has at least minimumSlots unused slots.
+	@param		int minimumSlots
+	@return		void
+	*/
+	void addSlab(int minimumSlots);
+
+	/**
+	Returns a slot for a new node, preferring the free list.
+	@return		A pointer to an unconstructed slot.
+	*/
+	Slot* takeSlot();
+
+	/**
+	Moves the never-used slots of the newest slab onto the free list, so
+	that they are kept when another slab is added.
+	@return		void
+	*/
+	void freeUnusedSlots();
+
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// -------------------------------------------------------------------------------------
+
+	NodePool();
+	NodePool(const NodePool<ItemType>& pool) = delete;
+	NodePool(NodePool<ItemType>&& pool);
+	virtual ~NodePool();
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Constructs a new node in this pool, forwarding the given arguments to
+	a constructor of BinaryNode.
+	@param		Args&&... args
+	@return		A pointer to the new node.
+	*/
+	template<class... Args>
+	BinaryNode<ItemType>* allocate(Args&&... args);
+
+	/**
+	Destroys the given node and puts its slot on the free list.
+	@pre		nodePtr was allocated by this pool and has not been
+					deallocated since.
+	@param		BinaryNode<ItemType>* nodePtr
+	@return		void
+	*/
+	void deallocate(BinaryNode<ItemType>* nodePtr);
+
+	/**
+	Makes sure that the given number of nodes can be allocated without
+	another slab being added.
+	@param		int count
+	@return		void
+	*/
+	void reserve(int count);
+
+	/**
+	Takes count consecutive slots that have never held a node, so that
+	several threads can construct nodes in them at once without going
+	through the pool.
+	@post		The slots count as allocated nodes.
+	@param		int count
+	@return		A pointer to the first of count unconstructed slots.
+	*/
+	BinaryNode<ItemType>* allocateBlock(int count);
+
+	/**
+	Puts the slots of a block back on the free list.
+	@pre		blockPtr was returned by allocateBlock(count) and no node
+					is constructed in the block.
+	@param		BinaryNode<ItemType>* blockPtr
+	@param		int count
+	@return		void
+	*/
+	void deallocateBlock(BinaryNode<ItemType>* blockPtr, int count);
+
+	/**
+	Hands nodeCount live nodes of this pool over to targetPool, which takes
+	a share of every arena of this pool so that the nodes stay where they
+	are. Both pools add their later slabs to new arenas, and an arena is
+	freed once neither pool holds it.
+	@pre		The nodes being handed over belong to the tree of
+					targetPool from now on, and will be deallocated by it.
+	@post		The nodes count as allocated by targetPool.
+	@param		NodePool<ItemType>& targetPool
+	@param		int nodeCount
+	@return		void
+	*/
+	void shareWith(NodePool<ItemType>& targetPool, int nodeCount);
+
+	/**
+	Releases every slab at once without destroying the nodes in them.
+	Arenas shared with other pools are kept until those release them too.
+	@pre		No node in this pool holds a data item that still needs
+					its destructor to run.
+	@post		The pool is empty and holds no memory of its own.
+	@return		void
+	*/
+	void releaseAll();
+
+	/**
+	Returns the current bookkeeping of this pool.
+	@return		The statistics of this pool.
+	*/
+	NodePoolStatistics getStatistics() const;
+
+	// -------------------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// -------------------------------------------------------------------------------------
+
+	NodePool& operator=(const NodePool& rightHandSide) = delete;
+
+	/**
+	Releases the slabs of this pool and takes over the arenas of
+	rightHandSide, which is left empty. Nodes keep their addresses.
+	@param		NodePool&& rightHandSide
+	@return		A reference to this pool.
+	*/
+	NodePool& operator=(NodePool&& rightHandSide);
+}; // end NodePool
+
+#include "NodePool.cpp"
@@ -0,0 +1,509 @@
+/**
+This templated class provides a persistent binary search tree: a tree
+whose versions share their nodes. Nodes are never changed once built. An
+update copies only the nodes on the path from the root to the changed
+node, and the few nodes its rotations move, and every other subtree is
+shared with the previous version.
+
+A node holds one reference to each of its children and a tree holds one
+to its root. Counts are raised with relaxed increments; the decrement
+that frees a node is an acquire-release operation, so every use of the
+node on other threads happens before it is deleted.
+
+@author		Solomon Colley
+@file		PersistentSearchTree.cpp
+@since		10/18/2026
+*/
+
+#include "PersistentSearchTree.h"
+
+// ---------------------------------------------------------------------------
+// Private Utility Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::Node::Node(const ItemType& anItem, const Node* leftPtr,
+	const Node* rightPtr) : item(anItem), leftChildPtr(leftPtr), rightChildPtr(rightPtr),
+	height(1 + std::max(getHeightOf(leftPtr), getHeightOf(rightPtr))),
+	size(1 + getSizeOf(leftPtr) + getSizeOf(rightPtr)), referenceCount(1)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::NodeReference::NodeReference(const Node* ownedPtr)
+	: nodePtr(ownedPtr)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::NodeReference::~NodeReference()
+{
+	release(nodePtr);
+} // end destructor
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::NodeReference::get() const
+{
+	return nodePtr;
+} // end get
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::NodeReference::take()
+{
+	const Node* ownedPtr = nodePtr;
+	nodePtr = nullptr;
+	return ownedPtr;
+} // end take
+
+template<class ItemType, class Compare>
+void PersistentSearchTree<ItemType, Compare>::NodeReference::reset(const Node* ownedPtr)
+{
+	release(nodePtr);
+	nodePtr = ownedPtr;
+} // end reset
+
+template<class ItemType, class Compare>
+bool PersistentSearchTree<ItemType, Compare>::lessThan(const ItemType& left, const ItemType& right) const
+{
+	return comparator(left, right);
+} // end lessThan
+
+template<class ItemType, class Compare>
+int PersistentSearchTree<ItemType, Compare>::getHeightOf(const Node* subTreePtr)
+{
+	return (subTreePtr != nullptr) ? subTreePtr->height : 0;
+} // end getHeightOf
+
+template<class ItemType, class Compare>
+int PersistentSearchTree<ItemType, Compare>::getSizeOf(const Node* subTreePtr)
+{
+	return (subTreePtr != nullptr) ? subTreePtr->size : 0;
+} // end getSizeOf
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::acquire(const Node* nodePtr)
+{
+	if (nodePtr != nullptr)
+		nodePtr->referenceCount.fetch_add(1, std::memory_order_relaxed); // end if-else
+
+	return nodePtr;
+} // end acquire
+
+template<class ItemType, class Compare>
+void PersistentSearchTree<ItemType, Compare>::release(const Node* nodePtr)
+{
+	if (nodePtr == nullptr || nodePtr->referenceCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return; // end if-else
+
+	// The children of a freed node lose a reference each, which may free
+	// them in turn.
+	std::vector<const Node*> nodeStack;
+	nodeStack.push_back(nodePtr);
+
+	while (!nodeStack.empty())
+	{
+		const Node* freedPtr = nodeStack.back();
+		nodeStack.pop_back();
+
+		const Node* childPtrs[] = { freedPtr->leftChildPtr, freedPtr->rightChildPtr };
+		for (const Node* childPtr : childPtrs)
+		{
+			if (childPtr != nullptr && childPtr->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				nodeStack.push_back(childPtr); // end if-else
+		} // end for
+
+		delete freedPtr;
+	} // end while
+} // end release
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::makeNode(const ItemType& anItem, const Node* leftPtr,
+	const Node* rightPtr)
+{
+	const Node* newNodePtr = new Node(anItem, leftPtr, rightPtr);
+	acquire(leftPtr);
+	acquire(rightPtr);
+	return newNodePtr;
+} // end makeNode
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::balance(const ItemType& anItem, const Node* leftPtr,
+	const Node* rightPtr)
+{
+	int leftHeight = getHeightOf(leftPtr);
+	int rightHeight = getHeightOf(rightPtr);
+
+	if (leftHeight > rightHeight + 1)
+	{
+		const Node* outerPtr = leftPtr->leftChildPtr;
+		const Node* innerPtr = leftPtr->rightChildPtr;
+
+		if (getHeightOf(outerPtr) >= getHeightOf(innerPtr))
+		{
+			// Single right rotation: the left child becomes the root.
+			NodeReference newRight(makeNode(anItem, innerPtr, rightPtr));
+			return makeNode(leftPtr->item, outerPtr, newRight.get());
+		}
+		else
+		{
+			// Double rotation: the inner grandchild becomes the root.
+			NodeReference newLeft(makeNode(leftPtr->item, outerPtr, innerPtr->leftChildPtr));
+			NodeReference newRight(makeNode(anItem, innerPtr->rightChildPtr, rightPtr));
+			return makeNode(innerPtr->item, newLeft.get(), newRight.get());
+		} // end if-else
+	}
+	else if (rightHeight > leftHeight + 1)
+	{
+		const Node* outerPtr = rightPtr->rightChildPtr;
+		const Node* innerPtr = rightPtr->leftChildPtr;
+
+		if (getHeightOf(outerPtr) >= getHeightOf(innerPtr))
+		{
+			// Single left rotation: the right child becomes the root.
+			NodeReference newLeft(makeNode(anItem, leftPtr, innerPtr));
+			return makeNode(rightPtr->item, newLeft.get(), outerPtr);
+		}
+		else
+		{
+			// Double rotation: the inner grandchild becomes the root.
+			NodeReference newLeft(makeNode(anItem, leftPtr, innerPtr->leftChildPtr));
+			NodeReference newRight(makeNode(rightPtr->item, innerPtr->rightChildPtr, outerPtr));
+			return makeNode(innerPtr->item, newLeft.get(), newRight.get());
+		} // end if-else
+	}
+	else
+		return makeNode(anItem, leftPtr, rightPtr); // end if-else
+} // end balance
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::rebuildPath(const Path& path, const Node* childPtr)
+{
+	NodeReference subTree(childPtr);
+
+	for (int depth = path.length - 1; depth >= 0; --depth)
+	{
+		const Node* originalPtr = path.steps[depth].nodePtr;
+		if (path.steps[depth].isLeft)
+			subTree.reset(balance(originalPtr->item, subTree.get(), originalPtr->rightChildPtr));
+		else
+			subTree.reset(balance(originalPtr->item, originalPtr->leftChildPtr, subTree.get())); // end if-else
+	} // end for
+
+	return subTree.take();
+} // end rebuildPath
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::insertEntry(const ItemType& newEntry) const
+{
+	// Equivalent entries go to the right, as in BinarySearchTree.
+	Path path;
+	path.length = 0;
+	for (const Node* currentPtr = rootPtr; currentPtr != nullptr; )
+	{
+		bool isLeft = lessThan(newEntry, currentPtr->item);
+		path.steps[path.length++] = PathStep{ currentPtr, isLeft };
+		currentPtr = isLeft ? currentPtr->leftChildPtr : currentPtr->rightChildPtr;
+	} // end for
+
+	return rebuildPath(path, makeNode(newEntry, nullptr, nullptr));
+} // end insertEntry
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::removeEntry(const ItemType& anEntry, bool& isRemoved) const
+{
+	// Find the first equivalent node as findNode does, recording the path.
+	Path path;
+	path.length = 0;
+	int targetDepth = -1;
+	for (const Node* currentPtr = rootPtr; currentPtr != nullptr; )
+	{
+		bool isLeft = !lessThan(currentPtr->item, anEntry);
+		if (isLeft)
+			targetDepth = path.length; // end if-else
+		path.steps[path.length++] = PathStep{ currentPtr, isLeft };
+		currentPtr = isLeft ? currentPtr->leftChildPtr : currentPtr->rightChildPtr;
+	} // end for
+
+	if (targetDepth < 0 || lessThan(anEntry, path.steps[targetDepth].nodePtr->item))
+	{
+		isRemoved = false;
+		return acquire(rootPtr);
+	} // end if-else
+
+	const Node* targetPtr = path.steps[targetDepth].nodePtr;
+	path.length = targetDepth;
+
+	const Node* replacementPtr;
+	if (targetPtr->leftChildPtr == nullptr || targetPtr->rightChildPtr == nullptr)
+		replacementPtr = acquire((targetPtr->leftChildPtr != nullptr) ? targetPtr->leftChildPtr
+			: targetPtr->rightChildPtr);
+	else
+	{
+		// Take the successor out of the right subtree and build it in place
+		// of the target.
+		Path successorPath;
+		successorPath.length = 0;
+		const Node* successorPtr = targetPtr->rightChildPtr;
+		while (successorPtr->leftChildPtr != nullptr)
+		{
+			successorPath.steps[successorPath.length++] = PathStep{ successorPtr, true };
+			successorPtr = successorPtr->leftChildPtr;
+		} // end while
+
+		NodeReference newRight(rebuildPath(successorPath, acquire(successorPtr->rightChildPtr)));
+		replacementPtr = balance(successorPtr->item, targetPtr->leftChildPtr, newRight.get());
+	} // end if-else
+
+	isRemoved = true;
+	return rebuildPath(path, replacementPtr);
+} // end removeEntry
+
+template<class ItemType, class Compare>
+const typename PersistentSearchTree<ItemType, Compare>::Node*
+PersistentSearchTree<ItemType, Compare>::findNode(const ItemType& target) const
+{
+	const Node* candidatePtr = nullptr;	// Last node not less than the target.
+	const Node* currentPtr = rootPtr;
+
+	while (currentPtr != nullptr)
+	{
+		if (lessThan(currentPtr->item, target))
+			currentPtr = currentPtr->rightChildPtr;
+		else
+		{
+			// Search the left subtree for an earlier match.
+			candidatePtr = currentPtr;
+			currentPtr = currentPtr->leftChildPtr;
+		} // end if-else
+	} // end while
+
+	if (candidatePtr == nullptr || lessThan(target, candidatePtr->item))
+		return nullptr;	// The node was not found.
+	else
+		return candidatePtr; // end if-else
+} // end findNode
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::preorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return applyVisitor(visit, subTreePtr->item)
+		&& preorderVisit(visit, subTreePtr->leftChildPtr)
+		&& preorderVisit(visit, subTreePtr->rightChildPtr);
+} // end preorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::inorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return inorderVisit(visit, subTreePtr->leftChildPtr)
+		&& applyVisitor(visit, subTreePtr->item)
+		&& inorderVisit(visit, subTreePtr->rightChildPtr);
+} // end inorderVisit
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::postorderVisit(Visitor& visit, const Node* subTreePtr)
+{
+	if (subTreePtr == nullptr)
+		return true; // end if-else
+
+	return postorderVisit(visit, subTreePtr->leftChildPtr)
+		&& postorderVisit(visit, subTreePtr->rightChildPtr)
+		&& applyVisitor(visit, subTreePtr->item);
+} // end postorderVisit
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::PersistentSearchTree() : rootPtr(nullptr), comparator()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::PersistentSearchTree(const Compare& treeComparator)
+	: rootPtr(nullptr), comparator(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::PersistentSearchTree(
+	const PersistentSearchTree<ItemType, Compare>& tree)
+	: rootPtr(acquire(tree.rootPtr)), comparator(tree.comparator)
+{
+} // end copy constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::PersistentSearchTree(PersistentSearchTree<ItemType, Compare>&& tree)
+	: rootPtr(tree.rootPtr), comparator(tree.comparator)
+{
+	tree.rootPtr = nullptr;
+} // end move constructor
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>::~PersistentSearchTree()
+{
+	release(rootPtr);
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+bool PersistentSearchTree<ItemType, Compare>::isEmpty() const
+{
+	return rootPtr == nullptr;
+} // end isEmpty
+
+template<class ItemType, class Compare>
+int PersistentSearchTree<ItemType, Compare>::getHeight() const
+{
+	return getHeightOf(rootPtr);
+} // end getHeight
+
+template<class ItemType, class Compare>
+int PersistentSearchTree<ItemType, Compare>::getNumberOfNodes() const
+{
+	return getSizeOf(rootPtr);
+} // end getNumberOfNodes
+
+template<class ItemType, class Compare>
+bool PersistentSearchTree<ItemType, Compare>::add(const ItemType& newEntry)
+{
+	const Node* newRootPtr = insertEntry(newEntry);
+	release(rootPtr);
+	rootPtr = newRootPtr;
+	return true;
+} // end add
+
+template<class ItemType, class Compare>
+bool PersistentSearchTree<ItemType, Compare>::remove(const ItemType& anEntry)
+{
+	bool isRemoved = false;
+	const Node* newRootPtr = removeEntry(anEntry, isRemoved);
+	release(rootPtr);
+	rootPtr = newRootPtr;
+	return isRemoved;
+} // end remove
+
+template<class ItemType, class Compare>
+void PersistentSearchTree<ItemType, Compare>::clear()
+{
+	release(rootPtr);
+	rootPtr = nullptr;
+} // end clear
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare> PersistentSearchTree<ItemType, Compare>::withEntry(
+	const ItemType& newEntry) const
+{
+	PersistentSearchTree<ItemType, Compare> newVersion(comparator);
+	newVersion.rootPtr = insertEntry(newEntry);
+	return newVersion;
+} // end withEntry
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare> PersistentSearchTree<ItemType, Compare>::withoutEntry(
+	const ItemType& anEntry) const
+{
+	bool isRemoved = false;
+	PersistentSearchTree<ItemType, Compare> newVersion(comparator);
+	newVersion.rootPtr = removeEntry(anEntry, isRemoved);
+	return newVersion;
+} // end withoutEntry
+
+template<class ItemType, class Compare>
+const ItemType& PersistentSearchTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	const Node* nodeWithEntry = findNode(anEntry);
+
+	if (nodeWithEntry == nullptr)
+		throw NotFoundException("The entry does not exist within the persistent search tree.");
+	else
+		return nodeWithEntry->item; // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool PersistentSearchTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	return findNode(anEntry) != nullptr;
+} // end contains
+
+template<class ItemType, class Compare>
+Compare PersistentSearchTree<ItemType, Compare>::getComparator() const
+{
+	return comparator;
+} // end getComparator
+
+// ---------------------------------------------------------------------------
+// Public Traversals Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::preorderTraverse(Visitor&& visit) const
+{
+	return preorderVisit(visit, rootPtr);
+} // end preorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::inorderTraverse(Visitor&& visit) const
+{
+	return inorderVisit(visit, rootPtr);
+} // end inorderTraverse
+
+template<class ItemType, class Compare>
+template<class Visitor>
+bool PersistentSearchTree<ItemType, Compare>::postorderTraverse(Visitor&& visit) const
+{
+	return postorderVisit(visit, rootPtr);
+} // end postorderTraverse
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>& PersistentSearchTree<ItemType, Compare>::operator=(
+	const PersistentSearchTree<ItemType, Compare>& rightHandSide)
+{
+	// Acquiring first keeps the nodes alive when both trees share them.
+	const Node* newRootPtr = acquire(rightHandSide.rootPtr);
+	release(rootPtr);
+	rootPtr = newRootPtr;
+	comparator = rightHandSide.comparator;
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+PersistentSearchTree<ItemType, Compare>& PersistentSearchTree<ItemType, Compare>::operator=(
+	PersistentSearchTree<ItemType, Compare>&& rightHandSide)
+{
+	if (this != &rightHandSide)
+	{
+		release(rootPtr);
+		rootPtr = rightHandSide.rootPtr;
+		comparator = rightHandSide.comparator;
+		rightHandSide.rootPtr = nullptr;
+	} // end if-else
+
+	return *this;
+} // end operator=
@@ -0,0 +1,323 @@
+/**
+This templated class provides a persistent binary search tree: a tree
+whose versions share their nodes. Nodes are never changed once built. An
+update copies only the nodes on the path from the root to the changed
+node, and the few nodes its rotations move, and every other subtree is
+shared with the previous version. Copying a tree is therefore a snapshot
+that costs O(1), and each add or remove allocates O(log n) nodes. The
+tree is balanced like an AVLTree, so the paths stay short.
+
+Nodes are reference counted with atomic counts, so different versions
+may be read and changed on different threads at once. A single tree
+object must not be changed while another thread uses it.
+
+@author		Solomon Colley
+@file		PersistentSearchTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "NotFoundException.h"
+#include "TreeVisitor.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class PersistentSearchTree
+{
+private:
+	// Bound on the height of an AVL tree of up to 2^31 nodes, which is less
+	// than 1.45 * log2(n + 2).
+	static const int MAX_HEIGHT = 48;
+
+	/**
+	A node of the tree. Everything but the reference count is fixed when
+	the node is built, so any number of versions can share it.
+	*/
+	struct Node
+	{
+		ItemType item;								// Data portion.
+		const Node* leftChildPtr;					// Pointer to the left child.
+		const Node* rightChildPtr;					// Pointer to the right child.
+		int height;									// Height of the subtree; a leaf has height 1.
+		int size;									// Number of nodes in the subtree.
+		mutable std::atomic<int> referenceCount;	// Trees and parent nodes that hold this node.
+
+		Node(const ItemType& anItem, const Node* leftPtr, const Node* rightPtr);
+	}; // end Node
+
+	/**
+	One step of the path from the root to a changed node: a node and the
+	side of it the path continues on.
+	*/
+	struct PathStep
+	{
+		const Node* nodePtr;
+		bool isLeft;
+	}; // end PathStep
+
+	/**
+	The path an update copies, held without allocating.
+	*/
+	struct Path
+	{
+		std::array<PathStep, MAX_HEIGHT> steps;
+		int length;
+	}; // end Path
+
+	/**
+	Holds one reference to a node until it is taken or goes out of scope,
+	so that the new nodes of an update are freed if copying an item throws.
+	*/
+	class NodeReference
+	{
+	private:
+		const Node* nodePtr;
+
+	public:
+		explicit NodeReference(const Node* ownedPtr);
+		~NodeReference();
+		NodeReference(const NodeReference& reference) = delete;
+		NodeReference& operator=(const NodeReference& rightHandSide) = delete;
+
+		const Node* get() const;
+		const Node* take();
+		void reset(const Node* ownedPtr);
+	}; // end NodeReference
+
+	const Node* rootPtr;	// Root node of this version, or nullptr if the tree is empty.
+	Compare comparator;		// Strict weak ordering of the entries.
+
+	// ---------------------------------------------------------------------------
+	// Private Utility Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Returns whether left is ordered before right by the comparator of
+	this tree.
+	@param		const ItemType& left
+	@param		const ItemType& right
+	@return		True if left comes before right, or false if not.
+	*/
+	bool lessThan(const ItemType& left, const ItemType& right) const;
+
+	/**
+	Returns the cached height or size of a subtree.
+	@param		const Node* subTreePtr
+	@return		The height or size, or 0 for an empty subtree.
+	*/
+	static int getHeightOf(const Node* subTreePtr);
+	static int getSizeOf(const Node* subTreePtr);
+
+	/**
+	Adds a reference to a node.
+	@param		const Node* nodePtr
+	@return		nodePtr, which may be nullptr.
+	*/
+	static const Node* acquire(const Node* nodePtr);
+
+	/**
+	Drops a reference to a node, deleting every node that no tree or other
+	node holds any more. Uses an explicit stack.
+	@param		const Node* nodePtr
+	@return		void
+	*/
+	static void release(const Node* nodePtr);
+
+	/**
+	Builds a node that holds a new reference to each of its children.
+	@param		const ItemType& anItem
+	@param		const Node* leftPtr
+	@param		const Node* rightPtr
+	@return		The new node, with one reference owned by the caller.
+	*/
+	static const Node* makeNode(const ItemType& anItem, const Node* leftPtr, const Node* rightPtr);
+
+	/**
+	Builds a balanced subtree of anItem between two subtrees whose heights
+	differ by at most 2, rotating by building new nodes if they differ by 2.
+	@param		const ItemType& anItem
+	@param		const Node* leftPtr
+	@param		const Node* rightPtr
+	@return		The root of the new subtree, with one reference owned by
+					the caller.
+	*/
+	static const Node* balance(const ItemType& anItem, const Node* leftPtr, const Node* rightPtr);
+
+	/**
+	Copies the nodes of a path bottom-up, putting childPtr in place of the
+	subtree the path leads to and rebalancing each copy.
+	@param		const Path& path
+	@param		const Node* childPtr
+					A subtree with one reference owned by the caller, which
+					this method takes over.
+	@return		The root of the new tree, with one reference owned by the
+					caller.
+	*/
+	static const Node* rebuildPath(const Path& path, const Node* childPtr);
+
+	/**
+	Returns the root of this version with newEntry added after any
+	equivalent entries.
+	@param		const ItemType& newEntry
+	@return		The new root, with one reference owned by the caller.
+	*/
+	const Node* insertEntry(const ItemType& newEntry) const;
+
+	/**
+	Returns the root of this version without the first entry in inorder
+	that is equivalent to anEntry.
+	@param		const ItemType& anEntry
+	@param		bool& isRemoved
+	@return		The new root, with one reference owned by the caller, or a
+					new reference to the current root if there was no such
+					entry.
+	*/
+	const Node* removeEntry(const ItemType& anEntry, bool& isRemoved) const;
+
+	/**
+	Returns the first node in inorder whose item is equivalent to target.
+	@param		const ItemType& target
+	@return		A pointer to the node, or nullptr if there is none.
+	*/
+	const Node* findNode(const ItemType& target) const;
+
+	/**
+	Traverses the subtree of subTreePtr, stopping as soon as visit returns
+	false. The recursion is as deep as the tree, which is balanced.
+	@param		Visitor& visit
+	@param		const Node* subTreePtr
+	@return		True if every entry was visited, or false if visit stopped
+					the traversal.
+	*/
+	template<class Visitor>
+	static bool preorderVisit(Visitor& visit, const Node* subTreePtr);
+	template<class Visitor>
+	static bool inorderVisit(Visitor& visit, const Node* subTreePtr);
+	template<class Visitor>
+	static bool postorderVisit(Visitor& visit, const Node* subTreePtr);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	PersistentSearchTree();
+	explicit PersistentSearchTree(const Compare& treeComparator);
+
+	/**
+	Takes a snapshot of tree in O(1) by sharing its root. Later changes to
+	either tree do not show in the other.
+	@param		const PersistentSearchTree& tree
+	*/
+	PersistentSearchTree(const PersistentSearchTree<ItemType, Compare>& tree);
+	PersistentSearchTree(PersistentSearchTree<ItemType, Compare>&& tree);
+
+	/**
+	Drops this version, deleting the nodes no other version shares.
+	*/
+	virtual ~PersistentSearchTree();
+
+	// ---------------------------------------------------------------------------
+	// Public Methods Section.
+	// ---------------------------------------------------------------------------
+
+	bool isEmpty() const;
+	int getHeight() const;
+	int getNumberOfNodes() const;
+
+	/**
+	Adds a new entry after any equivalent entries, copying the path to it.
+	Snapshots taken before are unchanged.
+	@post		The tree holds the new entry.
+	@param		const ItemType& newEntry
+	@return		True, since the entry is always added.
+	*/
+	bool add(const ItemType& newEntry);
+
+	/**
+	Removes the first entry in inorder that is equivalent to anEntry,
+	copying the path to it. Snapshots taken before are unchanged.
+	@post		One equivalent entry was removed if there was any.
+	@param		const ItemType& anEntry
+	@return		True if an entry was removed, or false if not.
+	*/
+	bool remove(const ItemType& anEntry);
+
+	/**
+	Removes every entry of this version.
+	@post		The tree is empty.
+	@return		void
+	*/
+	void clear();
+
+	/**
+	Returns a new version with newEntry added, leaving this one unchanged.
+	@param		const ItemType& newEntry
+	@return		The new version.
+	*/
+	PersistentSearchTree withEntry(const ItemType& newEntry) const;
+
+	/**
+	Returns a new version without the first entry in inorder that is
+	equivalent to anEntry, leaving this one unchanged.
+	@param		const ItemType& anEntry
+	@return		The new version, which shares the root of this one if there
+					was no such entry.
+	*/
+	PersistentSearchTree withoutEntry(const ItemType& anEntry) const;
+
+	/**
+	Returns the first entry equivalent to anEntry. The reference stays
+	valid until this tree is changed or destroyed.
+	@param		const ItemType& anEntry
+	@return		A reference to the entry.
+	@throws		NotFoundException if there is no such entry.
+	*/
+	const ItemType& getEntry(const ItemType& anEntry) const;
+
+	/**
+	Returns whether an entry equivalent to anEntry occurs in the tree.
+	@param		const ItemType& anEntry
+	@return		True if the entry was found, or false if not.
+	*/
+	bool contains(const ItemType& anEntry) const;
+
+	/**
+	Returns a copy of the comparator that orders the entries of this tree.
+	@return		The comparator of this tree.
+	*/
+	Compare getComparator() const;
+
+	// ---------------------------------------------------------------------------
+	// Public Traversals Section.
+	// The traversals pass a constant reference to each entry to visit and
+	// stop as soon as visit returns false, as in BinarySearchTree.
+	// ---------------------------------------------------------------------------
+
+	template<class Visitor>
+	bool preorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool inorderTraverse(Visitor&& visit) const;
+	template<class Visitor>
+	bool postorderTraverse(Visitor&& visit) const;
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Makes this tree a snapshot of rightHandSide in O(1).
+	@param		const PersistentSearchTree& rightHandSide
+	@return		A reference to this tree.
+	*/
+	PersistentSearchTree& operator=(const PersistentSearchTree<ItemType, Compare>& rightHandSide);
+	PersistentSearchTree& operator=(PersistentSearchTree<ItemType, Compare>&& rightHandSide);
+}; // end PersistentSearchTree
+
+#include "PersistentSearchTree.cpp"
@@ -0,0 +1,33 @@
+/**
+This file provides a portable hint for loading memory into the cache
+before it is read, so that the latency of independent loads can overlap.
+
+@author		Solomon Colley
+@file		Prefetch.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
+/**
+Asks the processor to start loading the cache line holding address for a
+later read. The hint never faults, so address may be nullptr or point
+past the end of an allocation, and it does nothing on compilers that
+offer no prefetch instruction.
+@param		const void* address
+@return		void
+*/
+inline void prefetchForRead(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+	(void)address;
+#endif
+} // end prefetchForRead
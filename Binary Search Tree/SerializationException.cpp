@@ -0,0 +1,20 @@
+/**
+This is an exception class. It is used for throwing any
+std::runtime_error pretaining to saving or loading a tree
+(e.g. a file that cannot be opened or holds no valid tree).
+
+@author		Solomon Colley
+@file		SerializationException.cpp
+@since		10/18/2026
+*/
+
+#include "SerializationException.h"
+
+// -------------------------------------------------------------------------------------
+// Constructor Section.
+// -------------------------------------------------------------------------------------
+
+SerializationException::SerializationException(const std::string& message)
+	: std::runtime_error("Serialization Exception: " + message)
+{
+} // end parameterized constructor
@@ -0,0 +1,24 @@
+/**
+This is an exception class. It is used for throwing any
+std::runtime_error pretaining to saving or loading a tree
+(e.g. a file that cannot be opened or holds no valid tree).
+
+@author		Solomon Colley
+@file		SerializationException.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+class SerializationException : public std::runtime_error
+{
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// -------------------------------------------------------------------------------------
+
+	SerializationException(const std::string& message = "");
+}; // end SerializationException
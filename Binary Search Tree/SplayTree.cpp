@@ -0,0 +1,328 @@
+/**
+This templated class provides a splay tree: a self-adjusting binary
+search tree that moves every entry it looks up, adds or removes to the
+root with top-down splaying, which keeps frequently used entries near
+the root.
+
+@author		Solomon Colley
+@file		SplayTree.cpp
+@since		10/18/2026
+*/
+
+#include "SplayTree.h"
+
+// ---------------------------------------------------------------------------
+// Protected Splaying Methods Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+template<class Key>
+int SplayTree<ItemType, Compare>::searchDirection(const BinaryNode<ItemType>* nodePtr, const Key& aKey,
+	bool stopsAtEquivalent) const
+{
+	if (this->lessThan(aKey, nodePtr->getItem()))
+		return -1;
+	else if (stopsAtEquivalent && !this->lessThan(nodePtr->getItem(), aKey))
+		return 0;
+	else
+		return 1; // end if-else
+} // end searchDirection
+
+template<class ItemType, class Compare>
+template<class Key>
+BinaryNode<ItemType>* SplayTree<ItemType, Compare>::splay(BinaryNode<ItemType>* subTreePtr, const Key& aKey,
+	bool stopsAtEquivalent, bool& isFound, int& depth) const
+{
+	// The nodes passed on the way down hang from two side trees. A node the
+	// search leaves to the left becomes the new smallest node of the right
+	// tree, and one it leaves to the right the new largest of the left tree.
+	BinaryNode<ItemType>* leftRootPtr = nullptr;
+	BinaryNode<ItemType>* leftMaxPtr = nullptr;
+	BinaryNode<ItemType>* rightRootPtr = nullptr;
+	BinaryNode<ItemType>* rightMinPtr = nullptr;
+	BinaryNode<ItemType>* currentPtr = subTreePtr;
+
+	++depth;
+	this->getCounters().countVisit();
+	int side = searchDirection(currentPtr, aKey, stopsAtEquivalent);
+
+	while (side != 0)
+	{
+		BinaryNode<ItemType>* childPtr = (side < 0) ? currentPtr->getLeftChildPtr()
+			: currentPtr->getRightChildPtr();
+		if (childPtr == nullptr)
+			break; // end if-else
+
+		++depth;
+		this->getCounters().countVisit();
+		int childSide = searchDirection(childPtr, aKey, stopsAtEquivalent);
+
+		if (childSide == side)
+		{
+			// The path goes straight on, so rotate the child above the
+			// current node, whose subtrees are then final.
+			if (side < 0)
+			{
+				currentPtr->setLeftChildPtr(childPtr->getRightChildPtr());
+				childPtr->setRightChildPtr(currentPtr);
+			}
+			else
+			{
+				currentPtr->setRightChildPtr(childPtr->getLeftChildPtr());
+				childPtr->setLeftChildPtr(currentPtr);
+			} // end if-else
+			currentPtr->updateHeightAndSize();
+			this->getCounters().countRotation();
+
+			currentPtr = childPtr;
+			childPtr = (side < 0) ? currentPtr->getLeftChildPtr() : currentPtr->getRightChildPtr();
+			if (childPtr == nullptr)
+				break; // end if-else
+
+			++depth;
+			this->getCounters().countVisit();
+			childSide = searchDirection(childPtr, aKey, stopsAtEquivalent);
+		} // end if-else
+
+		// Hang the current node from the side tree it belongs to.
+		if (side < 0)
+		{
+			if (rightMinPtr == nullptr)
+				rightRootPtr = currentPtr;
+			else
+				rightMinPtr->setLeftChildPtr(currentPtr); // end if-else
+			rightMinPtr = currentPtr;
+		}
+		else
+		{
+			if (leftMaxPtr == nullptr)
+				leftRootPtr = currentPtr;
+			else
+				leftMaxPtr->setRightChildPtr(currentPtr); // end if-else
+			leftMaxPtr = currentPtr;
+		} // end if-else
+
+		currentPtr = childPtr;
+		side = childSide;
+	} // end while
+
+	isFound = (side == 0);
+
+	// The subtrees of the new root go to the inner ends of the side trees,
+	// which then become its subtrees.
+	if (leftMaxPtr != nullptr)
+	{
+		leftMaxPtr->setRightChildPtr(currentPtr->getLeftChildPtr());
+		currentPtr->setLeftChildPtr(leftRootPtr);
+	} // end if-else
+
+	if (rightMinPtr != nullptr)
+	{
+		rightMinPtr->setLeftChildPtr(currentPtr->getRightChildPtr());
+		currentPtr->setRightChildPtr(rightRootPtr);
+	} // end if-else
+
+	// Only the spines of the side trees changed, so recompute them from
+	// their inner ends up to the new root.
+	for (BinaryNode<ItemType>* nodePtr = leftMaxPtr; nodePtr != nullptr && nodePtr != currentPtr;
+		nodePtr = nodePtr->getParentPtr())
+		nodePtr->updateHeightAndSize(); // end for
+
+	for (BinaryNode<ItemType>* nodePtr = rightMinPtr; nodePtr != nullptr && nodePtr != currentPtr;
+		nodePtr = nodePtr->getParentPtr())
+		nodePtr->updateHeightAndSize(); // end for
+
+	currentPtr->updateHeightAndSize();
+	currentPtr->setParentPtr(nullptr);
+	return currentPtr;
+} // end splay
+
+template<class ItemType, class Compare>
+template<class Key>
+BinaryNode<ItemType>* SplayTree<ItemType, Compare>::splayToRoot(const Key& aKey) const
+{
+	BinaryNode<ItemType>* rootPtr = this->getRootPtr();
+	bool isFound = false;
+	int depth = 0;
+
+	if (rootPtr != nullptr)
+	{
+		// A lookup leaves the entries as they were but moves the root, which
+		// is the one place a const splay tree changes itself. That is why a
+		// splay tree cannot be read by several threads at once.
+		rootPtr = splay(rootPtr, aKey, true, isFound, depth);
+		const_cast<SplayTree<ItemType, Compare>*>(this)->setRootPtr(rootPtr);
+	} // end if-else
+
+	this->getCounters().countLookup(depth);
+	return isFound ? rootPtr : nullptr;
+} // end splayToRoot
+
+// ---------------------------------------------------------------------------
+// Protected BinarySearchTree Overrides Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* SplayTree<ItemType, Compare>::insertInorder(BinaryNode<ItemType>* subTreePtr,
+	BinaryNode<ItemType>* newNodePtr)
+{
+	if (subTreePtr == nullptr)
+		return newNodePtr; // end if-else
+
+	// Equivalent entries go on to the right, so the new entry follows them.
+	bool isFound = false;
+	int depth = 0;
+	BinaryNode<ItemType>* rootPtr = splay(subTreePtr, newNodePtr->getItem(), false, isFound, depth);
+
+	if (this->lessThan(newNodePtr->getItem(), rootPtr->getItem()))
+	{
+		newNodePtr->setLeftChildPtr(rootPtr->getLeftChildPtr());
+		rootPtr->setLeftChildPtr(nullptr);
+		newNodePtr->setRightChildPtr(rootPtr);
+	}
+	else
+	{
+		newNodePtr->setRightChildPtr(rootPtr->getRightChildPtr());
+		rootPtr->setRightChildPtr(nullptr);
+		newNodePtr->setLeftChildPtr(rootPtr);
+	} // end if-else
+
+	rootPtr->updateHeightAndSize();
+	newNodePtr->updateHeightAndSize();
+	return newNodePtr;
+} // end insertInorder
+
+template<class ItemType, class Compare>
+BinaryNode<ItemType>* SplayTree<ItemType, Compare>::removeValue(BinaryNode<ItemType>* subTreePtr,
+	const ItemType& target,
+	bool& success)
+{
+	success = false;
+	if (subTreePtr == nullptr)
+		return nullptr; // end if-else
+
+	int depth = 0;
+	BinaryNode<ItemType>* rootPtr = splay(subTreePtr, target, true, success, depth);
+	if (!success)
+		return rootPtr; // end if-else
+
+	BinaryNode<ItemType>* leftPtr = rootPtr->getLeftChildPtr();
+	BinaryNode<ItemType>* rightPtr = rootPtr->getRightChildPtr();
+	BinaryNode<ItemType>* newRootPtr = rightPtr;
+
+	if (leftPtr != nullptr)
+	{
+		// No entry on the left is greater than the target, so splaying the
+		// left subtree past the target brings up its largest entry, which
+		// has no right child.
+		bool isFound = false;
+		newRootPtr = splay(leftPtr, target, false, isFound, depth);
+		newRootPtr->setRightChildPtr(rightPtr);
+		newRootPtr->updateHeightAndSize();
+	} // end if-else
+
+	this->deallocateNode(rootPtr);
+	return newRootPtr;
+} // end removeValue
+
+// ---------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::SplayTree() : BinarySearchTree<ItemType, Compare>()
+{
+} // end default constructor
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::SplayTree(const Compare& treeComparator)
+	: BinarySearchTree<ItemType, Compare>(treeComparator)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::SplayTree(const ItemType& rootItem) : BinarySearchTree<ItemType, Compare>(rootItem)
+{
+} // end parameterized constructor
+
+template<class ItemType, class Compare>
+template<class InputIterator>
+SplayTree<ItemType, Compare>::SplayTree(InputIterator first, InputIterator last,
+	const Compare& treeComparator) : BinarySearchTree<ItemType, Compare>(first, last, treeComparator)
+{
+} // end range constructor
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::SplayTree(const SplayTree<ItemType, Compare>& tree)
+	: BinarySearchTree<ItemType, Compare>(tree)
+{
+} // end copy constructor
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::SplayTree(SplayTree<ItemType, Compare>&& tree)
+	: BinarySearchTree<ItemType, Compare>(std::move(tree))
+{
+} // end move constructor
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>::~SplayTree()
+{
+} // end destructor
+
+// ---------------------------------------------------------------------------
+// Public Lookup Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+const ItemType& SplayTree<ItemType, Compare>::getEntry(const ItemType& anEntry) const
+{
+	BinaryNode<ItemType>* nodeWithEntry = splayToRoot(anEntry);
+
+	if (nodeWithEntry == nullptr)
+		throw NotFoundException("The entry does not exist within the binary search tree.");
+	else
+		return nodeWithEntry->getItem(); // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+bool SplayTree<ItemType, Compare>::contains(const ItemType& anEntry) const
+{
+	return splayToRoot(anEntry) != nullptr;
+} // end contains
+
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+const ItemType& SplayTree<ItemType, Compare>::getEntry(const Key& aKey) const
+{
+	BinaryNode<ItemType>* nodeWithEntry = splayToRoot(aKey);
+
+	if (nodeWithEntry == nullptr)
+		throw NotFoundException("The entry does not exist within the binary search tree.");
+	else
+		return nodeWithEntry->getItem(); // end if-else
+} // end getEntry
+
+template<class ItemType, class Compare>
+template<class Key, class C, class>
+bool SplayTree<ItemType, Compare>::contains(const Key& aKey) const
+{
+	return splayToRoot(aKey) != nullptr;
+} // end contains
+
+// ---------------------------------------------------------------------------
+// Overloaded Operator Section.
+// ---------------------------------------------------------------------------
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>& SplayTree<ItemType, Compare>::operator=(const SplayTree<ItemType, Compare>& rightHandSide)
+{
+	BinarySearchTree<ItemType, Compare>::operator=(rightHandSide);
+	return *this;
+} // end operator=
+
+template<class ItemType, class Compare>
+SplayTree<ItemType, Compare>& SplayTree<ItemType, Compare>::operator=(SplayTree<ItemType, Compare>&& rightHandSide)
+{
+	BinarySearchTree<ItemType, Compare>::operator=(std::move(rightHandSide));
+	return *this;
+} // end operator=
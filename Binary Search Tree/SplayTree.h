@@ -0,0 +1,150 @@
+/**
+This templated class provides a splay tree: a self-adjusting binary
+search tree that moves every entry it looks up, adds or removes to the
+root with top-down splaying. No balance information is kept, yet any
+sequence of m operations on n entries takes O(m log n) time, and an
+entry that was used recently sits near the root. When a few entries
+receive most of the lookups, as under a Zipf distribution, they stay
+within the top levels and are found after a handful of comparisons.
+
+Because contains and getEntry restructure the tree, even concurrent
+lookups must not share a splay tree without a lock, a lookup
+invalidates iterators as an addition does, and a splay tree must not
+be defined const. The other queries of
+BinarySearchTree, such as rank, the range queries and the batched
+lookups, search without splaying.
+
+@author		Solomon Colley
+@file		SplayTree.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <functional>
+#include "BinaryNode.h"
+#include "BinarySearchTree.h"
+#include "NotFoundException.h"
+
+template<class ItemType, class Compare = std::less<ItemType>>
+class SplayTree : public BinarySearchTree<ItemType, Compare>
+{
+protected:
+	// ---------------------------------------------------------------------------
+	// Protected Splaying Methods Section.
+	// ---------------------------------------------------------------------------
+
+	/**
+	Splays the subtree rooted at subTreePtr around aKey from the top down:
+	the search path is cut into a tree of the nodes ordered before aKey
+	and a tree of those ordered after it, pairs of nodes along a straight
+	stretch of the path are rotated on the way, and the node where the
+	search ends becomes the root over both trees. The heights and sizes
+	of the nodes that moved are recomputed by walking the parent pointers
+	back up from the bottom of each tree.
+	@pre		subTreePtr is not nullptr.
+	@post		The subtree holds the same entries, and its root is the
+					first node equivalent to aKey that the search met
+					or, when stopsAtEquivalent is false or there is none,
+					the last node on the search path.
+	@param		BinaryNode<ItemType>* subTreePtr
+	@param		const Key& aKey
+	@param		bool stopsAtEquivalent
+	@param		bool& isFound set to whether the new root is equivalent
+					to aKey, which is only known when stopsAtEquivalent
+					is true.
+	@param		int& depth increased by the number of nodes visited.
+	@return		A pointer to the new root of the subtree.
+	*/
+	template<class Key>
+	BinaryNode<ItemType>* splay(BinaryNode<ItemType>* subTreePtr, const Key& aKey, bool stopsAtEquivalent,
+		bool& isFound, int& depth) const;
+
+	/**
+	Returns on which side of a node the search for aKey goes on.
+	@param		const BinaryNode<ItemType>* nodePtr
+	@param		const Key& aKey
+	@param		bool stopsAtEquivalent
+	@return		-1 if aKey is ordered before the entry of the node, 1 if
+					after it, or 0 if it is equivalent and
+					stopsAtEquivalent is true. An equivalent key goes on
+					to the right when stopsAtEquivalent is false.
+	*/
+	template<class Key>
+	int searchDirection(const BinaryNode<ItemType>* nodePtr, const Key& aKey, bool stopsAtEquivalent) const;
+
+	/**
+	Splays the entry equivalent to aKey to the root of this tree, if
+	there is one, and counts the lookup. It is const so that contains and
+	getEntry can call it, but it replaces the root through a const_cast,
+	so it must only be called on a tree that was not defined const and
+	that no other thread is reading.
+	@param		const Key& aKey
+	@return		A pointer to the root if it holds an entry equivalent to
+					aKey, or nullptr if there is none.
+	*/
+	template<class Key>
+	BinaryNode<ItemType>* splayToRoot(const Key& aKey) const;
+
+	// ---------------------------------------------------------------------------
+	// Protected BinarySearchTree Overrides Section.
+	// See @file BinarySearchTree.h for documentation. Both overrides splay the
+	// position of the entry to the root first, so the new node becomes the
+	// root and a removed node is replaced by the largest entry before it.
+	// ---------------------------------------------------------------------------
+
+	BinaryNode<ItemType>* insertInorder(BinaryNode<ItemType>* subTreePtr,
+		BinaryNode<ItemType>* newNodePtr);
+	BinaryNode<ItemType>* removeValue(BinaryNode<ItemType>* subTreePtr,
+		const ItemType& target,
+		bool& success);
+
+public:
+	// ---------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// ---------------------------------------------------------------------------
+
+	SplayTree();
+	explicit SplayTree(const Compare& treeComparator);
+	SplayTree(const ItemType& rootItem);
+
+	/**
+	Constructs a splay tree holding the entries in the range [first, last),
+	which need not be sorted. A perfectly balanced tree is built. See
+	BinarySearchTree::assign.
+	@param		InputIterator first
+	@param		InputIterator last
+	@param		const Compare& treeComparator
+	*/
+	template<class InputIterator>
+	SplayTree(InputIterator first, InputIterator last, const Compare& treeComparator = Compare());
+	SplayTree(const SplayTree<ItemType, Compare>& tree);
+	SplayTree(SplayTree<ItemType, Compare>&& tree);
+	virtual ~SplayTree();
+
+	// ---------------------------------------------------------------------------
+	// Public Lookup Section.
+	// These behave as in @file BinarySearchTree.h, except that they splay
+	// the entry they find, or the last node they visit, to the root. The
+	// entry found is one equivalent to the key, which need not be the
+	// first in inorder when the tree holds duplicates.
+	// ---------------------------------------------------------------------------
+
+	const ItemType& getEntry(const ItemType& anEntry) const;
+	bool contains(const ItemType& anEntry) const;
+
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	const ItemType& getEntry(const Key& aKey) const;
+	template<class Key, class C = Compare, class = typename C::is_transparent>
+	bool contains(const Key& aKey) const;
+
+	// ---------------------------------------------------------------------------
+	// Overloaded Operator Section.
+	// See @file BinarySearchTree.h for documentation.
+	// ---------------------------------------------------------------------------
+
+	SplayTree<ItemType, Compare>& operator=(const SplayTree<ItemType, Compare>& rightHandSide);
+	SplayTree<ItemType, Compare>& operator=(SplayTree<ItemType, Compare>&& rightHandSide);
+}; // end SplayTree
+
+#include "SplayTree.cpp"
@@ -0,0 +1,252 @@
+/**
+This file provides the binary format in which the trees are saved. A
+BinaryWriter and a BinaryReader move bytes between a stream and a
+buffer of fixed size, so that a tree of any size is saved and loaded
+without the whole file ever being held in memory. An ItemCodec turns one
+entry into bytes and back.
+
+@author		Solomon Colley
+@file		TreeSerialization.cpp
+@since		10/18/2026
+*/
+
+#include "TreeSerialization.h"
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+	const char MAGIC[4] = { 'B', 'S', 'T', 'F' };	// First bytes of every saved tree.
+	const unsigned char LITTLE_ENDIAN_ORDER = 1;		// Byte order marks of the header.
+	const unsigned char BIG_ENDIAN_ORDER = 2;
+
+	/**
+	Returns the byte order mark of this machine.
+	@return		LITTLE_ENDIAN_ORDER or BIG_ENDIAN_ORDER.
+	*/
+	unsigned char getByteOrder()
+	{
+		const std::uint16_t probe = 1;
+		unsigned char firstByte;
+		std::memcpy(&firstByte, &probe, 1);
+		return (firstByte == 1) ? LITTLE_ENDIAN_ORDER : BIG_ENDIAN_ORDER;
+	} // end getByteOrder
+} // end namespace
+
+// -------------------------------------------------------------------------------------
+// BinaryWriter Section.
+// -------------------------------------------------------------------------------------
+
+BinaryWriter::BinaryWriter(std::ostream& output) : stream(output), buffer(new char[BUFFER_SIZE]),
+	bufferedBytes(0)
+{
+} // end parameterized constructor
+
+void BinaryWriter::writeBytes(const void* data, std::size_t count)
+{
+	const char* bytes = static_cast<const char*>(data);
+
+	while (count > 0)
+	{
+		if (bufferedBytes == BUFFER_SIZE)
+		{
+			if (!stream.write(buffer.get(), bufferedBytes))
+				throw SerializationException("The tree could not be written to the stream."); // end if-else
+			bufferedBytes = 0;
+		} // end if-else
+
+		std::size_t room = static_cast<std::size_t>(BUFFER_SIZE - bufferedBytes);
+		std::size_t chunk = (count < room) ? count : room;
+		std::memcpy(buffer.get() + bufferedBytes, bytes, chunk);
+		bufferedBytes += static_cast<int>(chunk);
+		bytes += chunk;
+		count -= chunk;
+	} // end while
+} // end writeBytes
+
+void BinaryWriter::writeByte(unsigned char value)
+{
+	writeBytes(&value, 1);
+} // end writeByte
+
+void BinaryWriter::writeVarint(unsigned long long value)
+{
+	unsigned char bytes[10];
+	int length = 0;
+
+	while (value >= 0x80)
+	{
+		bytes[length++] = static_cast<unsigned char>(value | 0x80);
+		value >>= 7;
+	} // end while
+	bytes[length++] = static_cast<unsigned char>(value);
+
+	writeBytes(bytes, length);
+} // end writeVarint
+
+void BinaryWriter::writeFixed64(unsigned long long value)
+{
+	unsigned char bytes[8];
+	for (int i = 0; i < 8; ++i)
+		bytes[i] = static_cast<unsigned char>(value >> (8 * i)); // end for
+
+	writeBytes(bytes, 8);
+} // end writeFixed64
+
+void BinaryWriter::writeHeader(char layout, unsigned int itemTag, long long count)
+{
+	writeBytes(MAGIC, sizeof(MAGIC));
+	writeByte(static_cast<unsigned char>(TreeFileFormat::VERSION));
+	writeByte(static_cast<unsigned char>(layout));
+	writeByte(getByteOrder());
+	writeVarint(itemTag);
+	writeFixed64(static_cast<unsigned long long>(count));
+} // end writeHeader
+
+void BinaryWriter::flush()
+{
+	if (!stream.write(buffer.get(), bufferedBytes) || !stream.flush())
+		throw SerializationException("The tree could not be written to the stream."); // end if-else
+
+	bufferedBytes = 0;
+} // end flush
+
+// -------------------------------------------------------------------------------------
+// BinaryReader Section.
+// -------------------------------------------------------------------------------------
+
+BinaryReader::BinaryReader(std::istream& input) : stream(input), buffer(new char[BUFFER_SIZE]),
+	bufferedBytes(0), position(0)
+{
+} // end parameterized constructor
+
+void BinaryReader::fillBuffer()
+{
+	stream.read(buffer.get(), BUFFER_SIZE);
+	bufferedBytes = static_cast<int>(stream.gcount());
+	position = 0;
+
+	if (bufferedBytes == 0)
+		throw SerializationException("The stream ended in the middle of a tree."); // end if-else
+} // end fillBuffer
+
+void BinaryReader::readBytes(void* data, std::size_t count)
+{
+	char* bytes = static_cast<char*>(data);
+
+	while (count > 0)
+	{
+		if (position == bufferedBytes)
+			fillBuffer(); // end if-else
+
+		std::size_t available = static_cast<std::size_t>(bufferedBytes - position);
+		std::size_t chunk = (count < available) ? count : available;
+		std::memcpy(bytes, buffer.get() + position, chunk);
+		position += static_cast<int>(chunk);
+		bytes += chunk;
+		count -= chunk;
+	} // end while
+} // end readBytes
+
+unsigned char BinaryReader::readByte()
+{
+	if (position == bufferedBytes)
+		fillBuffer(); // end if-else
+
+	return static_cast<unsigned char>(buffer[position++]);
+} // end readByte
+
+unsigned long long BinaryReader::readVarint()
+{
+	unsigned long long value = 0;
+
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		unsigned char byte = readByte();
+		value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			return value; // end if-else
+	} // end for
+
+	throw SerializationException("The stream holds an integer that is too long.");
+} // end readVarint
+
+unsigned long long BinaryReader::readFixed64()
+{
+	unsigned char bytes[8];
+	readBytes(bytes, 8);
+
+	unsigned long long value = 0;
+	for (int i = 0; i < 8; ++i)
+		value |= static_cast<unsigned long long>(bytes[i]) << (8 * i); // end for
+
+	return value;
+} // end readFixed64
+
+int BinaryReader::readHeader(char layout, unsigned int itemTag)
+{
+	char magic[sizeof(MAGIC)];
+	readBytes(magic, sizeof(magic));
+	if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+		throw SerializationException("The stream does not hold a saved tree."); // end if-else
+
+	if (readByte() != TreeFileFormat::VERSION)
+		throw SerializationException("The tree was saved in an unknown version of the format."); // end if-else
+
+	if (readByte() != static_cast<unsigned char>(layout))
+		throw SerializationException("The tree was saved in a different layout."); // end if-else
+
+	if (readByte() != getByteOrder() || readVarint() != itemTag)
+		throw SerializationException("The tree was saved with entries of a different kind or byte order."); // end if-else
+
+	unsigned long long count = readFixed64();
+	if (count > static_cast<unsigned long long>(INT_MAX))
+		throw SerializationException("The tree holds more entries than a tree can."); // end if-else
+
+	return static_cast<int>(count);
+} // end readHeader
+
+void BinaryReader::finish()
+{
+	int unusedBytes = bufferedBytes - position;
+	bufferedBytes = 0;
+	position = 0;
+
+	if (unusedBytes > 0)
+	{
+		stream.clear();
+		stream.seekg(-static_cast<std::streamoff>(unusedBytes), std::ios_base::cur);
+	} // end if-else
+} // end finish
+
+// -------------------------------------------------------------------------------------
+// ItemCodec Section.
+// -------------------------------------------------------------------------------------
+
+void ItemCodec<std::string>::write(BinaryWriter& writer, const std::string& anItem)
+{
+	writer.writeVarint(anItem.size());
+	writer.writeBytes(anItem.data(), anItem.size());
+} // end write
+
+std::string ItemCodec<std::string>::read(BinaryReader& reader)
+{
+	unsigned long long length = reader.readVarint();
+	std::string anItem;
+
+	// The characters are read in pieces, so a damaged length fails at the
+	// end of the stream instead of allocating a huge string up front.
+	const std::size_t PIECE_SIZE = 1 << 16;
+	while (length > 0)
+	{
+		std::size_t piece = (length < PIECE_SIZE) ? static_cast<std::size_t>(length) : PIECE_SIZE;
+		std::size_t oldSize = anItem.size();
+		anItem.resize(oldSize + piece);
+		reader.readBytes(&anItem[oldSize], piece);
+		length -= piece;
+	} // end while
+
+	return anItem;
+} // end read
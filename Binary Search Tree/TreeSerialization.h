@@ -0,0 +1,252 @@
+/**
+This file provides the binary format in which the trees are saved. A
+BinaryWriter and a BinaryReader move bytes between a stream and a
+buffer of fixed size, so that a tree of any size is saved and loaded
+without the whole file ever being held in memory. An ItemCodec turns one
+entry into bytes and back.
+
+Every saved tree starts with a header: the four bytes "BSTF", a version
+byte, a byte naming the layout of the entries, a byte giving the byte
+order of the machine that wrote it, the tag of the ItemCodec as a
+variable-length integer, and the number of entries as eight bytes in
+little-endian order. Entries that are copied as raw bytes keep the byte
+order of the writing machine, so a file is only loaded on a machine
+with the same byte order and entry size.
+
+@author		Solomon Colley
+@file		TreeSerialization.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include "SerializationException.h"
+
+/**
+The layouts a saved tree may have, as named by its header.
+*/
+struct TreeFileFormat
+{
+	static const char SORTED_ENTRIES = 'K';	// The entries in ascending order.
+	static const char PREORDER_SHAPE = 'S';	// The nodes in preorder, each with its children.
+	static const int VERSION = 1;			// Version written to the header.
+
+	static const unsigned char HAS_LEFT_CHILD = 1;	// Flags that precede each node of a shape.
+	static const unsigned char HAS_RIGHT_CHILD = 2;
+}; // end TreeFileFormat
+
+class BinaryWriter
+{
+private:
+	static const int BUFFER_SIZE = 1 << 16;	// Bytes collected before each write to the stream.
+
+	std::ostream& stream;				// Stream the bytes go to.
+	std::unique_ptr<char[]> buffer;		// Bytes not yet written to the stream.
+	int bufferedBytes;					// Number of bytes in the buffer.
+
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// -------------------------------------------------------------------------------------
+
+	explicit BinaryWriter(std::ostream& output);
+
+	BinaryWriter(const BinaryWriter& writer) = delete;
+	BinaryWriter& operator=(const BinaryWriter& rightHandSide) = delete;
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Writes count bytes starting at data.
+	@param		const void* data
+	@param		std::size_t count
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void writeBytes(const void* data, std::size_t count);
+
+	/**
+	Writes a single byte.
+	@param		unsigned char value
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void writeByte(unsigned char value);
+
+	/**
+	Writes value in seven-bit groups, lowest first, so that small values
+	take a single byte.
+	@param		unsigned long long value
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void writeVarint(unsigned long long value);
+
+	/**
+	Writes value as eight bytes in little-endian order.
+	@param		unsigned long long value
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void writeFixed64(unsigned long long value);
+
+	/**
+	Writes the header of a saved tree.
+	@param		char layout
+	@param		unsigned int itemTag
+	@param		long long count
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void writeHeader(char layout, unsigned int itemTag, long long count);
+
+	/**
+	Writes the buffered bytes to the stream and flushes it. Bytes that are
+	still buffered when the writer is destroyed are lost.
+	@return		void
+	@throws		SerializationException if the stream fails.
+	*/
+	void flush();
+}; // end BinaryWriter
+
+class BinaryReader
+{
+private:
+	static const int BUFFER_SIZE = 1 << 16;	// Bytes read from the stream at a time.
+
+	std::istream& stream;				// Stream the bytes come from.
+	std::unique_ptr<char[]> buffer;		// Bytes read but not yet used.
+	int bufferedBytes;					// Number of bytes in the buffer.
+	int position;						// Index of the next unused byte.
+
+	/**
+	Reads the next block of the stream into the buffer.
+	@return		void
+	@throws		SerializationException if the stream has ended.
+	*/
+	void fillBuffer();
+
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// -------------------------------------------------------------------------------------
+
+	explicit BinaryReader(std::istream& input);
+
+	BinaryReader(const BinaryReader& reader) = delete;
+	BinaryReader& operator=(const BinaryReader& rightHandSide) = delete;
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Reads count bytes into data.
+	@param		void* data
+	@param		std::size_t count
+	@return		void
+	@throws		SerializationException if the stream ends first.
+	*/
+	void readBytes(void* data, std::size_t count);
+
+	/**
+	Reads a single byte.
+	@return		The byte.
+	@throws		SerializationException if the stream has ended.
+	*/
+	unsigned char readByte();
+
+	/**
+	Reads a value written by BinaryWriter::writeVarint.
+	@return		The value.
+	@throws		SerializationException if the stream ends first or the
+					value does not fit in 64 bits.
+	*/
+	unsigned long long readVarint();
+
+	/**
+	Reads a value written by BinaryWriter::writeFixed64.
+	@return		The value.
+	@throws		SerializationException if the stream ends first.
+	*/
+	unsigned long long readFixed64();
+
+	/**
+	Reads the header of a saved tree and checks that it has the given
+	layout and entries of the kind written by the given ItemCodec.
+	@param		char layout
+	@param		unsigned int itemTag
+	@return		The number of entries of the tree.
+	@throws		SerializationException if the header does not match.
+	*/
+	int readHeader(char layout, unsigned int itemTag);
+
+	/**
+	Gives the bytes that were read ahead but not used back to the stream,
+	so that the stream is left just after the tree and may hold more data.
+	A stream that cannot seek back is left failed if any bytes were lost.
+	@return		void
+	*/
+	void finish();
+}; // end BinaryReader
+
+/**
+Saves and loads one entry. The general version copies the bytes of any
+trivially copyable type, and its tag is the size of the type. Other types
+need a specialization with a tag of their own, such as the one for
+std::string, whose tag is 0.
+*/
+template<class ItemType>
+struct ItemCodec
+{
+	static_assert(std::is_trivially_copyable<ItemType>::value,
+		"Specialize ItemCodec to save entries of this type.");
+
+	static const unsigned int TAG = static_cast<unsigned int>(sizeof(ItemType));
+
+	/**
+	Writes or reads one entry. read needs ItemType to be default
+	constructible.
+	@throws		SerializationException if the stream fails or ends.
+	*/
+	static void write(BinaryWriter& writer, const ItemType& anItem);
+	static ItemType read(BinaryReader& reader);
+}; // end ItemCodec
+
+/**
+Saves a string as its length followed by its characters.
+*/
+template<>
+struct ItemCodec<std::string>
+{
+	static const unsigned int TAG = 0;
+
+	static void write(BinaryWriter& writer, const std::string& anItem);
+	static std::string read(BinaryReader& reader);
+}; // end ItemCodec
+
+// -------------------------------------------------------------------------------------
+// Template Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class ItemType>
+void ItemCodec<ItemType>::write(BinaryWriter& writer, const ItemType& anItem)
+{
+	writer.writeBytes(&anItem, sizeof(ItemType));
+} // end write
+
+template<class ItemType>
+ItemType ItemCodec<ItemType>::read(BinaryReader& reader)
+{
+	ItemType anItem;
+	reader.readBytes(&anItem, sizeof(ItemType));
+	return anItem;
+} // end read
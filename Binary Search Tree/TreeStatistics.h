@@ -0,0 +1,284 @@
+/**
+This file provides the counters with which a tree reports the work done
+on its hot paths: comparisons, nodes visited, node allocations and
+frees, rotations, and a histogram of the depths at which lookups end.
+They show whether a slow lookup comes from a deep tree, costly
+comparisons or allocation, and a histogram whose mass drifts to deeper
+buckets warns that the tree is degrading.
+
+The counters are only compiled when BST_ENABLE_STATISTICS is defined,
+which the CMake option of the same name does. Otherwise TreeCounters
+has no data and every method is an empty inline function, so the hot
+paths compile exactly as if the counters were not there.
+
+Each counter is a relaxed atomic that is incremented by a separate load
+and store, which costs the same as a plain increment. Threads that read
+one tree at once never tear a count but may lose a few increments.
+
+@author		Solomon Colley
+@file		TreeStatistics.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+/**
+A snapshot of the counters of one tree since it was built or last reset.
+Dividing a total by the number of operations gives its cost per
+operation, e.g. comparisons / lookups.
+*/
+struct TreeStatistics
+{
+	static const int DEPTH_BUCKETS = 64;	// Lookups ending deeper than 62 levels share the last bucket.
+
+	long long lookups;			// Calls of contains and getEntry.
+	long long insertions;		// Entries added one at a time.
+	long long removals;			// Calls of remove.
+	long long comparisons;		// Calls of the comparator.
+	long long nodesVisited;		// Nodes read while searching for a place to look up, add or remove.
+	long long allocations;		// Nodes allocated.
+	long long deallocations;	// Nodes freed.
+	long long rotations;		// Single rotations, so a double rotation counts twice.
+
+	// depthHistogram[d] is the number of lookups that visited d nodes.
+	std::array<long long, DEPTH_BUCKETS> depthHistogram;
+
+	TreeStatistics();
+}; // end TreeStatistics
+
+class TreeCounters
+{
+private:
+#if defined(BST_ENABLE_STATISTICS)
+	mutable std::atomic<long long> lookups;
+	mutable std::atomic<long long> insertions;
+	mutable std::atomic<long long> removals;
+	mutable std::atomic<long long> comparisons;
+	mutable std::atomic<long long> nodesVisited;
+	mutable std::atomic<long long> allocations;
+	mutable std::atomic<long long> deallocations;
+	mutable std::atomic<long long> rotations;
+	mutable std::array<std::atomic<long long>, TreeStatistics::DEPTH_BUCKETS> depthHistogram;
+
+	/**
+	Adds amount to a counter without a locked instruction.
+	@param		std::atomic<long long>& counter
+	@param		long long amount
+	@return		void
+	*/
+	static void add(std::atomic<long long>& counter, long long amount);
+#endif
+
+public:
+	// Whether the counters were compiled in.
+#if defined(BST_ENABLE_STATISTICS)
+	static const bool IS_ENABLED = true;
+#else
+	static const bool IS_ENABLED = false;
+#endif
+
+	// -------------------------------------------------------------------------------------
+	// Constructor Section.
+	// The counters describe the operations on one tree object, so a copy
+	// starts from zero and assignment keeps the counts of the target.
+	// -------------------------------------------------------------------------------------
+
+	TreeCounters();
+	TreeCounters(const TreeCounters& counters);
+	TreeCounters& operator=(const TreeCounters& rightHandSide);
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Records one event, or count events, of the named kind. A lookup also
+	records the number of nodes it visited in the depth histogram.
+	@return		void
+	*/
+	void countComparison() const;
+	void countVisit() const;
+	void countLookup(int depth) const;
+	void countInsertion() const;
+	void countRemoval() const;
+	void countAllocations(long long count) const;
+	void countDeallocations(long long count) const;
+	void countRotation() const;
+
+	/**
+	Returns the current counts, which are all zero when the counters are
+	not compiled in.
+	@return		A snapshot of the counters.
+	*/
+	TreeStatistics getStatistics() const;
+
+	/**
+	Sets every counter back to zero.
+	@return		void
+	*/
+	void reset() const;
+}; // end TreeCounters
+
+// -------------------------------------------------------------------------------------
+// Inline Methods Section.
+// -------------------------------------------------------------------------------------
+
+inline TreeStatistics::TreeStatistics()
+	: lookups(0), insertions(0), removals(0), comparisons(0), nodesVisited(0),
+	allocations(0), deallocations(0), rotations(0), depthHistogram()
+{
+} // end default constructor
+
+#if defined(BST_ENABLE_STATISTICS)
+
+inline void TreeCounters::add(std::atomic<long long>& counter, long long amount)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+} // end add
+
+inline TreeCounters::TreeCounters()
+{
+	reset();
+} // end default constructor
+
+inline TreeCounters::TreeCounters(const TreeCounters&)
+{
+	reset();
+} // end copy constructor
+
+inline TreeCounters& TreeCounters::operator=(const TreeCounters&)
+{
+	return *this;
+} // end operator=
+
+inline void TreeCounters::countComparison() const
+{
+	add(comparisons, 1);
+} // end countComparison
+
+inline void TreeCounters::countVisit() const
+{
+	add(nodesVisited, 1);
+} // end countVisit
+
+inline void TreeCounters::countLookup(int depth) const
+{
+	add(lookups, 1);
+	add(depthHistogram[(depth < TreeStatistics::DEPTH_BUCKETS) ? depth : TreeStatistics::DEPTH_BUCKETS - 1], 1);
+} // end countLookup
+
+inline void TreeCounters::countInsertion() const
+{
+	add(insertions, 1);
+} // end countInsertion
+
+inline void TreeCounters::countRemoval() const
+{
+	add(removals, 1);
+} // end countRemoval
+
+inline void TreeCounters::countAllocations(long long count) const
+{
+	add(allocations, count);
+} // end countAllocations
+
+inline void TreeCounters::countDeallocations(long long count) const
+{
+	add(deallocations, count);
+} // end countDeallocations
+
+inline void TreeCounters::countRotation() const
+{
+	add(rotations, 1);
+} // end countRotation
+
+inline TreeStatistics TreeCounters::getStatistics() const
+{
+	TreeStatistics statistics;
+	statistics.lookups = lookups.load(std::memory_order_relaxed);
+	statistics.insertions = insertions.load(std::memory_order_relaxed);
+	statistics.removals = removals.load(std::memory_order_relaxed);
+	statistics.comparisons = comparisons.load(std::memory_order_relaxed);
+	statistics.nodesVisited = nodesVisited.load(std::memory_order_relaxed);
+	statistics.allocations = allocations.load(std::memory_order_relaxed);
+	statistics.deallocations = deallocations.load(std::memory_order_relaxed);
+	statistics.rotations = rotations.load(std::memory_order_relaxed);
+	for (int depth = 0; depth < TreeStatistics::DEPTH_BUCKETS; ++depth)
+		statistics.depthHistogram[depth] = depthHistogram[depth].load(std::memory_order_relaxed); // end for
+	return statistics;
+} // end getStatistics
+
+inline void TreeCounters::reset() const
+{
+	lookups.store(0, std::memory_order_relaxed);
+	insertions.store(0, std::memory_order_relaxed);
+	removals.store(0, std::memory_order_relaxed);
+	comparisons.store(0, std::memory_order_relaxed);
+	nodesVisited.store(0, std::memory_order_relaxed);
+	allocations.store(0, std::memory_order_relaxed);
+	deallocations.store(0, std::memory_order_relaxed);
+	rotations.store(0, std::memory_order_relaxed);
+	for (std::atomic<long long>& bucket : depthHistogram)
+		bucket.store(0, std::memory_order_relaxed); // end for
+} // end reset
+
+#else
+
+inline TreeCounters::TreeCounters()
+{
+} // end default constructor
+
+inline TreeCounters::TreeCounters(const TreeCounters&)
+{
+} // end copy constructor
+
+inline TreeCounters& TreeCounters::operator=(const TreeCounters&)
+{
+	return *this;
+} // end operator=
+
+inline void TreeCounters::countComparison() const
+{
+} // end countComparison
+
+inline void TreeCounters::countVisit() const
+{
+} // end countVisit
+
+inline void TreeCounters::countLookup(int) const
+{
+} // end countLookup
+
+inline void TreeCounters::countInsertion() const
+{
+} // end countInsertion
+
+inline void TreeCounters::countRemoval() const
+{
+} // end countRemoval
+
+inline void TreeCounters::countAllocations(long long) const
+{
+} // end countAllocations
+
+inline void TreeCounters::countDeallocations(long long) const
+{
+} // end countDeallocations
+
+inline void TreeCounters::countRotation() const
+{
+} // end countRotation
+
+inline TreeStatistics TreeCounters::getStatistics() const
+{
+	return TreeStatistics();
+} // end getStatistics
+
+inline void TreeCounters::reset() const
+{
+} // end reset
+
+#endif
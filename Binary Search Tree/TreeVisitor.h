@@ -0,0 +1,51 @@
+/**
+This file provides the helper through which the templated traversals of
+every tree call their visitor, so that a visitor may either return void
+or return whether the traversal should go on.
+
+@author		Solomon Colley
+@file		TreeVisitor.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <type_traits>
+
+/**
+Calls visit with the given data item and reports whether the traversal
+should go on. A visitor that returns void never stops the traversal; any
+other result is converted to bool, and false stops it.
+@param		Visitor& visit
+@param		const ItemType& anItem
+@return		True if the traversal should continue, or false if not.
+*/
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem);
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem, std::true_type returnsVoid);
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem, std::false_type returnsVoid);
+
+// -------------------------------------------------------------------------------------
+// Template Functions Section.
+// -------------------------------------------------------------------------------------
+
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem)
+{
+	return applyVisitor(visit, anItem, std::is_void<decltype(visit(anItem))>());
+} // end applyVisitor
+
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem, std::true_type)
+{
+	visit(anItem);
+	return true;
+} // end applyVisitor
+
+template<class Visitor, class ItemType>
+bool applyVisitor(Visitor& visit, const ItemType& anItem, std::false_type)
+{
+	return static_cast<bool>(visit(anItem));
+} // end applyVisitor
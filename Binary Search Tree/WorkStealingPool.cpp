@@ -0,0 +1,203 @@
+/**
+This class provides a pool of worker threads for fork-join parallelism
+over the subtrees of a tree. Every worker owns a queue of tasks: it runs
+the newest task of its own queue first and, once that is empty, steals
+the oldest task from another queue, which is the largest piece of work
+left there. Threads outside the pool submit their tasks to one shared
+queue. A TaskGroup collects the tasks forked for one job, and the thread
+that waits for the group runs queued tasks itself until the group is
+done, so nested groups never deadlock.
+
+@author		Solomon Colley
+@file		WorkStealingPool.cpp
+@since		10/18/2026
+*/
+
+#include "WorkStealingPool.h"
+
+namespace
+{
+	// The pool and queue of the calling thread, if it is a worker.
+	thread_local const WorkStealingPool* currentPoolPtr = nullptr;
+	thread_local int currentWorkerIndex = -1;
+} // end namespace
+
+// -------------------------------------------------------------------------------------
+// Private Utility Methods Section.
+// -------------------------------------------------------------------------------------
+
+int WorkStealingPool::getQueueIndex() const
+{
+	if (currentPoolPtr == this)
+		return currentWorkerIndex;
+	else
+		return static_cast<int>(workers.size()); // end if-else
+} // end getQueueIndex
+
+void WorkStealingPool::submit(Task&& task)
+{
+	TaskQueue& queue = *queues[getQueueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue.queueMutex);
+		queue.tasks.push_back(std::move(task));
+	}
+	queuedTasks.fetch_add(1, std::memory_order_release);
+
+	// Taking the lock orders the count before a worker checks it and sleeps.
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+	}
+	wakeCondition.notify_one();
+} // end submit
+
+bool WorkStealingPool::runPendingTask(int queueIndex)
+{
+	if (queuedTasks.load(std::memory_order_acquire) == 0)
+		return false; // end if-else
+
+	Task task;
+	bool isFound = false;
+	int queueCount = static_cast<int>(queues.size());
+
+	// The own queue is tried first, from the newest end, then the others
+	// from the oldest end.
+	for (int offset = 0; offset < queueCount && !isFound; ++offset)
+	{
+		TaskQueue& queue = *queues[(queueIndex + offset) % queueCount];
+		std::lock_guard<std::mutex> lock(queue.queueMutex);
+		if (!queue.tasks.empty())
+		{
+			if (offset == 0)
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+			} // end if-else
+			isFound = true;
+		} // end if-else
+	} // end for
+
+	if (!isFound)
+		return false; // end if-else
+
+	queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+	try
+	{
+		task.function();
+	}
+	catch (...)
+	{
+		task.groupPtr->recordError(std::current_exception());
+	} // end try-catch
+
+	task.groupPtr->pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+	return true;
+} // end runPendingTask
+
+void WorkStealingPool::runWorker(int workerIndex)
+{
+	currentPoolPtr = this;
+	currentWorkerIndex = workerIndex;
+
+	while (true)
+	{
+		if (runPendingTask(workerIndex))
+			continue; // end if-else
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		wakeCondition.wait(lock, [this]()
+		{
+			return isStopping || queuedTasks.load(std::memory_order_acquire) > 0;
+		});
+		if (isStopping)
+			return; // end if-else
+	} // end while
+} // end runWorker
+
+// -------------------------------------------------------------------------------------
+// Constructor and Destructor Section.
+// -------------------------------------------------------------------------------------
+
+WorkStealingPool::WorkStealingPool(int workerCount) : queuedTasks(0), isStopping(false)
+{
+	for (int i = 0; i <= workerCount; ++i)
+		queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue())); // end for
+
+	for (int i = 0; i < workerCount; ++i)
+		workers.emplace_back(&WorkStealingPool::runWorker, this, i); // end for
+} // end parameterized constructor
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		isStopping = true;
+	}
+	wakeCondition.notify_all();
+
+	for (std::thread& worker : workers)
+		worker.join(); // end for
+} // end destructor
+
+// -------------------------------------------------------------------------------------
+// Public Methods Section.
+// -------------------------------------------------------------------------------------
+
+WorkStealingPool& WorkStealingPool::getDefault()
+{
+	static WorkStealingPool pool(std::thread::hardware_concurrency() > 1
+		? static_cast<int>(std::thread::hardware_concurrency()) - 1 : 0);
+	return pool;
+} // end getDefault
+
+int WorkStealingPool::getWorkerCount() const
+{
+	return static_cast<int>(workers.size());
+} // end getWorkerCount
+
+// -------------------------------------------------------------------------------------
+// TaskGroup Section.
+// -------------------------------------------------------------------------------------
+
+TaskGroup::TaskGroup(WorkStealingPool& taskPool) : pool(taskPool), pendingTasks(0)
+{
+} // end parameterized constructor
+
+TaskGroup::~TaskGroup()
+{
+	join();
+} // end destructor
+
+void TaskGroup::recordError(std::exception_ptr error)
+{
+	std::lock_guard<std::mutex> lock(errorMutex);
+	if (!firstError)
+		firstError = error; // end if-else
+} // end recordError
+
+void TaskGroup::join()
+{
+	int queueIndex = pool.getQueueIndex();
+	while (pendingTasks.load(std::memory_order_acquire) > 0)
+	{
+		if (!pool.runPendingTask(queueIndex))
+			std::this_thread::yield(); // end if-else
+	} // end while
+} // end join
+
+void TaskGroup::wait()
+{
+	join();
+
+	std::exception_ptr error;
+	{
+		std::lock_guard<std::mutex> lock(errorMutex);
+		std::swap(error, firstError);
+	}
+	if (error)
+		std::rethrow_exception(error); // end if-else
+} // end wait
@@ -0,0 +1,205 @@
+/**
+This class provides a pool of worker threads for fork-join parallelism
+over the subtrees of a tree. Every worker owns a queue of tasks: it runs
+the newest task of its own queue first and, once that is empty, steals
+the oldest task from another queue, which is the largest piece of work
+left there. Threads outside the pool submit their tasks to one shared
+queue. A TaskGroup collects the tasks forked for one job, and the thread
+that waits for the group runs queued tasks itself until the group is
+done, so nested groups never deadlock.
+
+The tasks are subtrees of thousands of nodes, so each queue is a deque
+guarded by its own mutex rather than a lock-free deque.
+
+@author		Solomon Colley
+@file		WorkStealingPool.h
+@since		10/18/2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class TaskGroup;
+
+class WorkStealingPool
+{
+private:
+	/**
+	A forked piece of work and the group it belongs to.
+	*/
+	struct Task
+	{
+		std::function<void()> function;		// The work to run.
+		TaskGroup* groupPtr;				// Group that waits for the task.
+	}; // end Task
+
+	/**
+	The tasks of one worker, or of the threads outside the pool.
+	*/
+	struct TaskQueue
+	{
+		std::mutex queueMutex;			// Guards tasks.
+		std::deque<Task> tasks;			// Oldest task at the front.
+	}; // end TaskQueue
+
+	std::vector<std::unique_ptr<TaskQueue>> queues;	// One per worker, then the shared queue.
+	std::vector<std::thread> workers;					// The worker threads.
+	std::atomic<int> queuedTasks;						// Tasks waiting in all queues.
+	std::mutex sleepMutex;								// Guards the sleep of idle workers.
+	std::condition_variable wakeCondition;				// Wakes idle workers.
+	bool isStopping;									// Tells the workers to exit.
+
+	friend class TaskGroup;
+
+	/**
+	Returns the queue of the calling thread: its own queue for a worker of
+	this pool, or the shared queue for any other thread.
+	@return		The index of the queue.
+	*/
+	int getQueueIndex() const;
+
+	/**
+	Queues a task for the calling thread and wakes an idle worker.
+	@param		Task&& task
+	@return		void
+	*/
+	void submit(Task&& task);
+
+	/**
+	Takes the newest task of the given queue or, failing that, the oldest
+	task of another queue, and runs it.
+	@param		int queueIndex
+	@return		True if a task was run, or false if every queue was empty.
+	*/
+	bool runPendingTask(int queueIndex);
+
+	/**
+	Runs tasks until the pool is destroyed, sleeping while there are none.
+	@param		int workerIndex
+	@return		void
+	*/
+	void runWorker(int workerIndex);
+
+public:
+	// -------------------------------------------------------------------------------------
+	// Constructor and Destructor Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Starts the given number of worker threads. A pool without workers runs
+	every task on the thread that waits for it.
+	@param		int workerCount
+	*/
+	explicit WorkStealingPool(int workerCount);
+
+	/**
+	Stops and joins the workers.
+	@pre		No task group of this pool is still running.
+	*/
+	virtual ~WorkStealingPool();
+
+	WorkStealingPool(const WorkStealingPool& pool) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool& rightHandSide) = delete;
+
+	// -------------------------------------------------------------------------------------
+	// Public Methods Section.
+	// -------------------------------------------------------------------------------------
+
+	/**
+	Returns the pool shared by the trees, which has one worker for every
+	hardware thread beyond the first, since the calling thread works too.
+	It is started on first use.
+	@return		A reference to the shared pool.
+	*/
+	static WorkStealingPool& getDefault();
+
+	/**
+	Returns the number of worker threads.
+	@return		The number of workers, not counting the calling thread.
+	*/
+	int getWorkerCount() const;
+}; // end WorkStealingPool
+
+/**
+A set of tasks forked on a pool that a thread waits for together. Tasks
+may fork more tasks into the same group while it runs.
+*/
+class TaskGroup
+{
+private:
+	WorkStealingPool& pool;				// Pool the tasks run on.
+	std::atomic<int> pendingTasks;		// Tasks forked but not yet finished.
+	std::mutex errorMutex;				// Guards firstError.
+	std::exception_ptr firstError;		// First exception thrown by a task.
+
+	friend class WorkStealingPool;
+
+	/**
+	Records the exception a task threw, keeping only the first.
+	@param		std::exception_ptr error
+	@return		void
+	*/
+	void recordError(std::exception_ptr error);
+
+	/**
+	Runs queued tasks until every task of this group has finished.
+	@return		void
+	*/
+	void join();
+
+public:
+	explicit TaskGroup(WorkStealingPool& taskPool = WorkStealingPool::getDefault());
+
+	/**
+	Waits for the tasks of the group without rethrowing their exceptions.
+	*/
+	~TaskGroup();
+
+	TaskGroup(const TaskGroup& group) = delete;
+	TaskGroup& operator=(const TaskGroup& rightHandSide) = delete;
+
+	/**
+	Forks a task that may run on any thread of the pool.
+	@param		Function&& function
+	@return		void
+	*/
+	template<class Function>
+	void run(Function&& function);
+
+	/**
+	Waits until every task of this group has finished, running queued
+	tasks meanwhile.
+	@return		void
+	@throws		The first exception thrown by a task of this group.
+	*/
+	void wait();
+}; // end TaskGroup
+
+// -------------------------------------------------------------------------------------
+// Template Methods Section.
+// -------------------------------------------------------------------------------------
+
+template<class Function>
+void TaskGroup::run(Function&& function)
+{
+	pendingTasks.fetch_add(1, std::memory_order_relaxed);
+	try
+	{
+		pool.submit(WorkStealingPool::Task{ std::function<void()>(std::forward<Function>(function)), this });
+	}
+	catch (...)
+	{
+		pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+		throw;
+	} // end try-catch
+} // end run
@@ -0,0 +1,97 @@
+/**
+This program checks that the traversals of a ConcurrentSearchTree stay in
+order while other threads add and remove entries. Reader threads walk
+the tree in inorder over and over while writer threads toggle random
+keys, and every traversal must see its entries in ascending order. The
+tree is kept small so that removals often hit nodes a reader is inside.
+It exits with a nonzero status if any traversal was out of order.
+
+@author		Solomon Colley
+@file		ConcurrentSearchTreeTest.cpp
+@since		10/18/2026
+*/
+
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "ConcurrentSearchTree.h"
+
+namespace
+{
+	const int KEY_RANGE = 256;				// Keys are drawn from [0, KEY_RANGE).
+	const int WRITER_COUNT = 4;				// Threads adding and removing keys.
+	const int READER_COUNT = 4;				// Threads traversing the tree.
+	const int TRAVERSALS_PER_READER = 100000;	// Traversals each reader checks.
+
+	/**
+	Traverses the tree in inorder and reports whether every entry was
+	not less than the one before it.
+	@param		const ConcurrentSearchTree<int>& tree
+	@return		True if the traversal was in order, or false if not.
+	*/
+	bool isTraversalOrdered(const ConcurrentSearchTree<int>& tree)
+	{
+		bool isFirst = true;
+		int previousEntry = 0;
+
+		return tree.inorderTraverse([&](const int& anEntry)
+		{
+			bool isOrdered = isFirst || previousEntry <= anEntry;
+			isFirst = false;
+			previousEntry = anEntry;
+			return isOrdered;
+		});
+	} // end isTraversalOrdered
+} // end namespace
+
+int main()
+{
+	ConcurrentSearchTree<int> tree;
+	std::mt19937 fillEngine(1);
+	for (int i = 0; i < KEY_RANGE / 2; ++i)
+		tree.add(static_cast<int>(fillEngine() % KEY_RANGE)); // end for
+
+	std::atomic<bool> isDone(false);
+	std::atomic<int> unorderedTraversals(0);
+
+	std::vector<std::thread> writers;
+	for (int writerIndex = 0; writerIndex < WRITER_COUNT; ++writerIndex)
+	{
+		writers.emplace_back([&, writerIndex]()
+		{
+			std::mt19937 engine(100 + writerIndex);
+			while (!isDone.load(std::memory_order_relaxed))
+			{
+				int key = static_cast<int>(engine() % KEY_RANGE);
+				if (!tree.remove(key))
+					tree.add(key); // end if-else
+			} // end while
+		});
+	} // end for
+
+	std::vector<std::thread> readers;
+	for (int readerIndex = 0; readerIndex < READER_COUNT; ++readerIndex)
+	{
+		readers.emplace_back([&]()
+		{
+			for (int i = 0; i < TRAVERSALS_PER_READER; ++i)
+			{
+				if (!isTraversalOrdered(tree))
+					unorderedTraversals.fetch_add(1); // end if-else
+			} // end for
+		});
+	} // end for
+
+	for (std::thread& reader : readers)
+		reader.join(); // end for
+	isDone.store(true, std::memory_order_relaxed);
+	for (std::thread& writer : writers)
+		writer.join(); // end for
+
+	int failures = unorderedTraversals.load();
+	std::cout << failures << " of " << READER_COUNT * TRAVERSALS_PER_READER
+		<< " traversals were out of order.\n";
+	return (failures == 0) ? 0 : 1;
+} // end main